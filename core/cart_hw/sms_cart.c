@@ -358,7 +358,6 @@ static void write_mapper_terebi(unsigned int address, unsigned char data);
 static unsigned char read_mapper_93c46(unsigned int address);
 static unsigned char read_mapper_terebi(unsigned int address);
 static unsigned char read_mapper_korea_8k(unsigned int address);
-static unsigned char read_mapper_default(unsigned int address);
 
 void sms_cart_init(void)
 {
@@ -756,7 +755,7 @@ static void mapper_reset(void)
     }
 
     /* set default Z80 memory handlers */
-    z80_readmem = read_mapper_default;
+    z80_readmem = NULL;
     z80_writemem = write_mapper_none;
     return;
   }
@@ -833,17 +832,17 @@ static void mapper_reset(void)
     case MAPPER_NONE:
     case MAPPER_RAM_8K_EXT1:
     case MAPPER_RAM_8K_EXT2:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_none;
       break;
 
     case MAPPER_CODIES:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_codies;
       break;
 
     case MAPPER_KOREA:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_korea;
       break;
 
@@ -853,18 +852,18 @@ static void mapper_reset(void)
       break;
 
     case MAPPER_KOREA_16K:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_korea_16k;
       break;
 
     case MAPPER_MSX:
     case MAPPER_MSX_NEMESIS:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_msx;
       break;
 
     case MAPPER_MULTI:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_multi;
       break;
 
@@ -879,7 +878,7 @@ static void mapper_reset(void)
       break;
 
     default:
-      z80_readmem = read_mapper_default;
+      z80_readmem = NULL;
       z80_writemem = write_mapper_sega;
       break;
   }
@@ -1317,8 +1316,3 @@ static unsigned char read_mapper_korea_8k(unsigned int address)
 
   return data;
 }
-
-static unsigned char read_mapper_default(unsigned int address)
-{
-  return z80_readmap[address >> 10][address & 0x03FF];
-}
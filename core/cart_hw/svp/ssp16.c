@@ -330,11 +330,11 @@
   if ((op & 0x0f) == SSP_P) { /* A <- P */ \
     read_P(); /* update P */ \
     OP(rP.v); \
-    break; \
+    return; \
   } \
   if ((op & 0x0f) == SSP_A) { /* A <- A */ \
     OP(rA32); \
-    break; \
+    return; \
   } \
 }
 
@@ -425,17 +425,14 @@ static u32 read_P(void)
 
 /* ----------------------------------------------------- */
 
-static int get_inc(int mode)
+/* PM address increment, indexed by mode bits 15 (decrement) and 13-11 */
+static const int pm_inc[16] =
 {
-  int inc = (mode >> 11) & 7;
-  if (inc != 0) {
-    if (inc != 7) inc--;
-    /* inc = (1<<16) << inc; */
-    inc = 1 << inc; /* 0 1 2 4 8 16 32 128 */
-    if (mode & 0x8000) inc = -inc; /* decrement mode */
-  }
-  return inc;
-}
+  0,  1,  2,  4,  8,  16,  32,  128,
+  0, -1, -2, -4, -8, -16, -32, -128
+};
+
+#define get_inc(mode) pm_inc[(((mode) >> 11) & 7) | (((mode) >> 12) & 8)]
 
 #define overwite_write(dst, d) \
 { \
@@ -972,6 +969,351 @@ static u32 ptr2_read(int op)
 }
 
 
+/* ----------------------------------------------------- */
+/* specialised pointer register handlers */
+
+/* (rX+), rX being r0-r2 or r4-r6 */
+static u32 ptr1_read_inc(int ri, int isj2)
+{
+  unsigned char *rp = &rIJ[ri|isj2];
+  u32 mask, t = ssp->mem.RAM[(isj2<<6)|*rp];
+  if (!(rST&7)) { (*rp)++; return t; }
+  mask = (1 << (rST&7)) - 1;
+  *rp = (*rp & ~mask) | ((*rp + 1) & mask);
+  return t;
+}
+
+/* (r3|00)..(r3|11), (r7|00)..(r7|11) */
+#define ptr1_fixed(op) ssp->mem.RAM[((op)&0x100)|(((op)>>2)&3)]
+
+/* (rX+) or (rX+!) write, rX being r0-r2 or r4-r6 (modulo not applied) */
+#define ptr1_inc(op) ssp->mem.RAM[((op)&0x100)|rIJ[((op)&3)|(((op)>>6)&4)]++]
+
+
+/* ----------------------------------------------------- */
+/* instruction handlers */
+
+typedef void (*op_func_t)(int op);
+
+static void op_unknown(int op)
+{
+#ifdef LOG_SVP
+  elprintf(EL_ANOMALY|EL_SVP, "ssp FIXME unhandled op %04x @ %04x", op, GET_PPC_OFFS());
+#endif
+}
+
+/* ld d, s */
+static void op_ld_d_s(int op)
+{
+  u32 tmpv;
+  if (op == 0) return; /* nop */
+  if (op == ((SSP_A<<4)|SSP_P)) { /* A <- P */
+    /* not sure. MAME claims that only hi word is transfered. */
+    read_P(); /* update P */
+    rA32 = rP.v;
+  }
+  else
+  {
+    tmpv = REG_READ(op & 0x0f);
+    REG_WRITE((op & 0xf0) >> 4, tmpv);
+  }
+}
+
+/* ld d, (ri) */
+static void op_ld_d_ri(int op) { u32 tmpv = ptr1_read(op); REG_WRITE((op & 0xf0) >> 4, tmpv); }
+static void op_ld_d_ri_inc(int op) { u32 tmpv = ptr1_read_inc(op&3, (op>>6)&4); REG_WRITE((op & 0xf0) >> 4, tmpv); }
+static void op_ld_d_ri_fixed(int op) { u32 tmpv = ptr1_fixed(op); REG_WRITE((op & 0xf0) >> 4, tmpv); }
+
+/* ld (ri), s */
+static void op_ld_ri_s(int op) { u32 tmpv = REG_READ((op & 0xf0) >> 4); ptr1_write(op, tmpv); }
+static void op_ld_ri_inc_s(int op) { u32 tmpv = REG_READ((op & 0xf0) >> 4); ptr1_inc(op) = tmpv; }
+static void op_ld_ri_fixed_s(int op) { u32 tmpv = REG_READ((op & 0xf0) >> 4); ptr1_fixed(op) = tmpv; }
+
+/* ldi d, imm */
+static void op_ldi_d_imm(int op) { u32 tmpv = *PC++; REG_WRITE((op & 0xf0) >> 4, tmpv); }
+
+/* ld d, ((ri)) */
+static void op_ld_d_rri(int op) { u32 tmpv = ptr2_read(op); REG_WRITE((op & 0xf0) >> 4, tmpv); }
+
+/* ldi (ri), imm */
+static void op_ldi_ri_imm(int op) { u32 tmpv = *PC++; ptr1_write(op, tmpv); }
+
+/* ld adr, a */
+static void op_ld_adr_a(int op) { ssp->mem.RAM[op & 0x1ff] = rA; }
+
+/* ld d, ri */
+static void op_ld_d_r(int op) { u32 tmpv = rIJ[(op&3)|((op>>6)&4)]; REG_WRITE((op & 0xf0) >> 4, tmpv); }
+
+/* ld ri, s */
+static void op_ld_r_s(int op) { rIJ[(op&3)|((op>>6)&4)] = REG_READ((op & 0xf0) >> 4); }
+
+/* ldi ri, simm */
+static void op_ldi_r_simm(int op) { rIJ[(op>>8)&7] = op; }
+
+/* call cond, addr */
+static void op_call(int op)
+{
+  int cond = 0;
+  COND_CHECK
+  if (cond) { int new_PC = *PC++; write_STACK(GET_PC()); write_PC(new_PC); }
+  else PC++;
+}
+
+/* ld d, (a) */
+static void op_ld_d_a(int op) { u32 tmpv = ((unsigned short *)svp->iram_rom)[rA]; REG_WRITE((op & 0xf0) >> 4, tmpv); }
+
+/* bra cond, addr */
+static void op_bra(int op)
+{
+  int cond = 0;
+  COND_CHECK
+  if (cond) { int new_PC = *PC++; write_PC(new_PC); }
+  else PC++;
+}
+
+/* mod cond, op */
+static void op_mod(int op)
+{
+  int cond = 0;
+  COND_CHECK
+  if (cond) {
+    switch (op & 7) {
+      case 2: rA32 = (signed int)rA32 >> 1; break; /* shr (arithmetic) */
+      case 3: rA32 <<= 1; break; /* shl */
+      case 6: rA32 = -(signed int)rA32; break; /* neg */
+      case 7: if ((int)rA32 < 0) rA32 = -(signed int)rA32; break; /* abs */
+      default:
+#ifdef LOG_SVP
+        elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: unhandled mod %i @ %04x",
+          op&7, GET_PPC_OFFS());
+#endif
+        break;
+    }
+    UPD_ACC_ZN /* ? */
+  }
+}
+
+/* mpys? */
+static void op_mpys(int op)
+{
+#ifdef LOG_SVP
+  if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#endif
+  read_P(); /* update P */
+  rA32 -= rP.v;  /* maybe only upper word? */
+  UPD_ACC_ZN      /* there checking flags after this */
+  rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
+  rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
+}
+
+/* mpya (rj), (ri), b */
+static void op_mpya(int op)
+{
+#ifdef LOG_SVP
+  if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#endif
+  read_P(); /* update P */
+  rA32 += rP.v; /* confirmed to be 32bit */
+  UPD_ACC_ZN /* ? */
+  rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
+  rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
+}
+
+/* mpya (rj+), (ri+), b */
+static void op_mpya_inc(int op)
+{
+#ifdef LOG_SVP
+  if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#endif
+  read_P(); /* update P */
+  rA32 += rP.v; /* confirmed to be 32bit */
+  UPD_ACC_ZN /* ? */
+  rX = ptr1_read_inc(op&3, 0);
+  rY = ptr1_read_inc((op>>4)&3, 4);
+}
+
+/* mld (rj), (ri), b */
+static void op_mld(int op)
+{
+#ifdef LOG_SVP
+  if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#endif
+  rA32 = 0;
+  rST &= 0x0fff; /* ? */
+  rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
+  rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
+}
+
+/* mld (rj+), (ri+), b */
+static void op_mld_inc(int op)
+{
+#ifdef LOG_SVP
+  if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#endif
+  rA32 = 0;
+  rST &= 0x0fff; /* ? */
+  rX = ptr1_read_inc(op&3, 0);
+  rY = ptr1_read_inc((op>>4)&3, 4);
+}
+
+/* OP a, adr (ld) */
+static void op_lda_adr(int op) { u32 tmpv = ssp->mem.RAM[op & 0x1ff]; OP_LDA(tmpv); }
+
+#ifdef LOG_SVP
+#define SIMM_CHECK \
+  if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
+#else
+#define SIMM_CHECK
+#endif
+
+/* OP a, s / OP a, (ri) / OP a, adr / OP a, imm / OP a, ((ri)) / OP a, ri / OP simm */
+#define OP_HANDLERS(name, OP, OP32) \
+static void op_##name##_s(int op) { u32 tmpv; OP_CHECK32(OP32); tmpv = REG_READ(op & 0x0f); OP(tmpv); } \
+static void op_##name##_ri(int op) { u32 tmpv = ptr1_read(op); OP(tmpv); } \
+static void op_##name##_adr(int op) { u32 tmpv = ssp->mem.RAM[op & 0x1ff]; OP(tmpv); } \
+static void op_##name##_imm(int op) { u32 tmpv = *PC++; OP(tmpv); } \
+static void op_##name##_rri(int op) { u32 tmpv = ptr2_read(op); OP(tmpv); } \
+static void op_##name##_r(int op) { u32 tmpv = rIJ[IJind]; OP(tmpv); } \
+static void op_##name##_simm(int op) { OP(op & 0xff); SIMM_CHECK }
+
+OP_HANDLERS(sub, OP_SUBA, OP_SUBA32)
+OP_HANDLERS(cmp, OP_CMPA, OP_CMPA32)
+OP_HANDLERS(add, OP_ADDA, OP_ADDA32)
+/* MAME code only does LSB of top word (OP simm), but this looks wrong to me. */
+OP_HANDLERS(and, OP_ANDA, OP_ANDA32)
+OP_HANDLERS(or,  OP_ORA,  OP_ORA32)
+OP_HANDLERS(eor, OP_EORA, OP_EORA32)
+
+#define OP_ROW(name) \
+  op_##name##_s,   op_##name##_ri,   op_unknown,     op_##name##_adr,  /* x0 - x3 */ \
+  op_##name##_imm, op_##name##_rri,  op_unknown,     op_unknown,       /* x4 - x7 */ \
+  op_unknown,      op_##name##_r,    op_unknown
+
+/* indexed by op >> 9 */
+static const op_func_t op_handlers[128] =
+{
+  op_ld_d_s,     op_ld_d_ri,    op_ld_ri_s,    op_lda_adr,    /* 00 - 03 */
+  op_ldi_d_imm,  op_ld_d_rri,   op_ldi_ri_imm, op_ld_adr_a,   /* 04 - 07 */
+  op_unknown,    op_ld_d_r,     op_ld_r_s,     op_unknown,    /* 08 - 0b */
+  op_ldi_r_simm, op_ldi_r_simm, op_ldi_r_simm, op_ldi_r_simm, /* 0c - 0f */
+  OP_ROW(sub),   op_mpys,       op_sub_simm,   op_unknown,    op_unknown,    op_unknown,    /* 10 - 1f */
+  op_unknown,    op_unknown,    op_unknown,    op_unknown,    /* 20 - 23 */
+  op_call,       op_ld_d_a,     op_bra,        op_unknown,    /* 24 - 27 */
+  op_unknown,    op_unknown,    op_unknown,    op_unknown,    /* 28 - 2b */
+  op_unknown,    op_unknown,    op_unknown,    op_unknown,    /* 2c - 2f */
+  OP_ROW(cmp),   op_unknown,    op_cmp_simm,   op_unknown,    op_unknown,    op_unknown,    /* 30 - 3f */
+  op_add_s,      op_add_ri,     op_unknown,    op_add_adr,    /* 40 - 43 */
+  op_add_imm,    op_add_rri,    op_unknown,    op_unknown,    /* 44 - 47 */
+  op_mod,        op_add_r,      op_unknown,    op_mpya,       /* 48 - 4b */
+  op_add_simm,   op_unknown,    op_unknown,    op_unknown,    /* 4c - 4f */
+  OP_ROW(and),   op_mld,        op_and_simm,   op_unknown,    op_unknown,    op_unknown,    /* 50 - 5f */
+  OP_ROW(or),    op_unknown,    op_or_simm,    op_unknown,    op_unknown,    op_unknown,    /* 60 - 6f */
+  OP_ROW(eor),   op_unknown,    op_eor_simm,   op_unknown,    op_unknown,    op_unknown     /* 70 - 7f */
+};
+
+/* ld PMx, s (s being -, X, Y or A) or ld PMx, (ri), repeated: PM register block transfer */
+static int op_pm_batch_check(int op)
+{
+  int d = (op >> 4) & 0x0f;
+  if ((d < SSP_PM0) || (d > SSP_PM4)) return 0;
+  if ((op >> 9) == 0x01) return 1;
+  return ((op >> 9) == 0x00) && ((op & 0x0f) <= SSP_A);
+}
+
+static void op_pm_batch(int op)
+{
+  int reg = ((op >> 4) & 0x0f) - SSP_PM0;
+  int mode = -1, inc = 0;
+
+  for (;;)
+  {
+    u32 pmac = ssp->pmac[1][reg];
+
+    if ((int)(pmac >> 16) == mode)
+    {
+      /* DRAM write, PM register mode already checked */
+      unsigned short *dram = (unsigned short *)svp->dram;
+      int addr = pmac & 0xffff;
+      u32 d = (op & 0x200) ? ptr1_read(op) : ssp->gr[op & 0x0f].byte.h;
+      if (mode & 0x0400) {
+             overwite_write(dram[addr], d);
+      } else dram[addr] = d;
+      if (mode & 0x4000) pmac += (addr&1) ? 31 : 1; /* cell inc */
+      else pmac += inc;
+      rPMC.v = ssp->pmac[1][reg] = pmac;
+    }
+    else
+    {
+      op_handlers[op >> 9](op);
+
+      /* next transfers can skip pm_io when PM register is set for DRAM writes */
+      mode = -1;
+#ifndef LOG_SVP
+      if (!(ssp->emu_status & (SSP_PMC_SET|SSP_PMC_HAVE_ADDR)) && ((reg == 4) || (rST & 0x60)))
+      {
+        int m = ssp->pmac[1][reg] >> 16;
+        if (((m & 0x43ff) == 0x0018) || ((m & 0xfbff) == 0x4018))
+        {
+          mode = m;
+          inc = get_inc(m);
+        }
+      }
+#endif
+    }
+
+    /* same checks as interpreter loop before next instruction */
+    if ((g_cycles <= 1) || (ssp->emu_status & SSP_WAIT_MASK) || (*PC != op)) return;
+    PC++;
+    g_cycles--;
+  }
+}
+
+/* select handler, using specialised ones for most common pointer register modes */
+static op_func_t op_decode(int op)
+{
+  switch (op >> 9)
+  {
+    case 0x01: /* ld d, (ri) */
+      if ((op & 3) == 3) return op_ld_d_ri_fixed;
+      if ((op & 0x0c) == 0x0c) return op_ld_d_ri_inc;
+      break;
+    case 0x02: /* ld (ri), s */
+      if ((op & 3) == 3) return op_ld_ri_fixed_s;
+      if (op & 0x04) return op_ld_ri_inc_s;
+      break;
+    case 0x4b: /* mpya (rj), (ri), b */
+      if (((op & 0xcc) == 0xcc) && ((op & 0x03) != 0x03) && ((op & 0x30) != 0x30)) return op_mpya_inc;
+      break;
+    case 0x5b: /* mld (rj), (ri), b */
+      if (((op & 0xcc) == 0xcc) && ((op & 0x03) != 0x03) && ((op & 0x30) != 0x30)) return op_mld_inc;
+      break;
+  }
+  return op_handlers[op >> 9];
+}
+
+
+
+/* ----------------------------------------------------- */
+/* predecoded instruction traces */
+
+#define SSP_CACHE_TRACES 512
+#define SSP_CACHE_LENGTH 16
+
+typedef struct
+{
+  unsigned short *pc;  /* instruction address */
+  op_func_t handler;   /* instruction handler */
+  unsigned short op;   /* instruction word */
+} ssp_cache_entry;
+
+typedef struct
+{
+  unsigned int count;  /* number of recorded instructions */
+  ssp_cache_entry entry[SSP_CACHE_LENGTH];
+} ssp_cache_trace;
+
+static ssp_cache_trace ssp_cache[SSP_CACHE_TRACES];
+
 /* ----------------------------------------------------- */
 
 void ssp1601_reset(ssp1601_t *l_ssp)
@@ -982,6 +1324,7 @@ void ssp1601_reset(ssp1601_t *l_ssp)
   rPC = 0x400;
   rSTACK = 0; /* ? using ascending stack */
   rST = 0;
+  memset(ssp_cache, 0, sizeof(ssp_cache));
 }
 
 
@@ -1086,241 +1429,81 @@ static void debug(unsigned int pc, unsigned int op)
 #endif /* USE_DEBUGGER */
 
 
-void ssp1601_run(int cycles)
+
+/* Execute instructions from predecoded trace starting at current PC */
+static void ssp_cache_execute(void)
 {
-  SET_PC(rPC);
-  g_cycles = cycles;
+  ssp_cache_trace *trace = &ssp_cache[GET_PC() & (SSP_CACHE_TRACES - 1)];
+  ssp_cache_entry *entry = trace->entry;
 
-  do
+  /* Execute recorded trace until program flow leaves it */
+  if (trace->count && (entry->pc == PC))
   {
-    int op;
-    u32 tmpv;
+    ssp_cache_entry *last = entry + trace->count;
 
-    op = *PC++;
-#ifdef USE_DEBUGGER
-    debug(GET_PC()-1, op);
-#endif
-    switch (op >> 9)
+    do
     {
-      /* ld d, s */
-      case 0x00:
-        if (op == 0) break; /* nop */
-        if (op == ((SSP_A<<4)|SSP_P)) { /* A <- P */
-          /* not sure. MAME claims that only hi word is transfered. */
-          read_P(); /* update P */
-          rA32 = rP.v;
-        }
-        else
-        {
-          tmpv = REG_READ(op & 0x0f);
-          REG_WRITE((op & 0xf0) >> 4, tmpv);
-        }
-        break;
-
-      /* ld d, (ri) */
-      case 0x01: tmpv = ptr1_read(op); REG_WRITE((op & 0xf0) >> 4, tmpv); break;
-
-      /* ld (ri), s */
-      case 0x02: tmpv = REG_READ((op & 0xf0) >> 4); ptr1_write(op, tmpv); break;
-
-      /* ldi d, imm */
-      case 0x04: tmpv = *PC++; REG_WRITE((op & 0xf0) >> 4, tmpv); break;
-
-      /* ld d, ((ri)) */
-      case 0x05: tmpv = ptr2_read(op); REG_WRITE((op & 0xf0) >> 4, tmpv); break;
-
-      /* ldi (ri), imm */
-      case 0x06: tmpv = *PC++; ptr1_write(op, tmpv); break;
-
-      /* ld adr, a */
-      case 0x07: ssp->mem.RAM[op & 0x1ff] = rA; break;
-
-      /* ld d, ri */
-      case 0x09: tmpv = rIJ[(op&3)|((op>>6)&4)]; REG_WRITE((op & 0xf0) >> 4, tmpv); break;
-
-      /* ld ri, s */
-      case 0x0a: rIJ[(op&3)|((op>>6)&4)] = REG_READ((op & 0xf0) >> 4); break;
-
-      /* ldi ri, simm */
-      case 0x0c:
-      case 0x0d:
-      case 0x0e:
-      case 0x0f: rIJ[(op>>8)&7] = op; break;
-
-      /* call cond, addr */
-      case 0x24: {
-        int cond = 0;
-        COND_CHECK
-        if (cond) { int new_PC = *PC++; write_STACK(GET_PC()); write_PC(new_PC); }
-        else PC++;
-        break;
+      /* IRAM might have been rewritten since trace was recorded */
+      if (*PC != entry->op)
+      {
+        trace->count = entry - trace->entry;
+        trace = &ssp_cache[GET_PC() & (SSP_CACHE_TRACES - 1)];
+        goto record;
       }
 
-      /* ld d, (a) */
-      case 0x25: tmpv = ((unsigned short *)svp->iram_rom)[rA]; REG_WRITE((op & 0xf0) >> 4, tmpv); break;
+#ifdef USE_DEBUGGER
+      debug(GET_PC(), entry->op);
+#endif
+      PC++;
+      entry->handler(entry->op);
+    }
+    while ((--g_cycles > 0) && !(ssp->emu_status & SSP_WAIT_MASK) && (++entry < last) && (entry->pc == PC));
 
-      /* bra cond, addr */
-      case 0x26: {
-        int cond = 0;
-        COND_CHECK
-        if (cond) { int new_PC = *PC++; write_PC(new_PC); }
-        else PC++;
-        break;
-      }
+    return;
+  }
 
-      /* mod cond, op */
-      case 0x48: {
-        int cond = 0;
-        COND_CHECK
-        if (cond) {
-          switch (op & 7) {
-            case 2: rA32 = (signed int)rA32 >> 1; break; /* shr (arithmetic) */
-            case 3: rA32 <<= 1; break; /* shl */
-            case 6: rA32 = -(signed int)rA32; break; /* neg */
-            case 7: if ((int)rA32 < 0) rA32 = -(signed int)rA32; break; /* abs */
-            default:
-#ifdef LOG_SVP
-              elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: unhandled mod %i @ %04x",
-                op&7, GET_PPC_OFFS());
-#endif
-              break;
-          }
-          UPD_ACC_ZN /* ? */
-        }
-        break;
-      }
+record:
+  /* Record new trace while executing instructions */
+  trace->count = 0;
+  do
+  {
+    int op = *PC;
 
-      /* mpys? */
-      case 0x1b:
-#ifdef LOG_SVP
-        if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+#ifndef USE_DEBUGGER
+    /* repeated PM register transfers are merged into one entry */
+    if (trace->count && (entry->op == op) && op_pm_batch_check(op))
+    {
+      entry->handler = op_pm_batch;
+      PC++;
+      op_handlers[op >> 9](op);
+      continue;
+    }
 #endif
-        read_P(); /* update P */
-        rA32 -= rP.v;  /* maybe only upper word? */
-        UPD_ACC_ZN      /* there checking flags after this */
-        rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
-        rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
-        break;
 
-      /* mpya (rj), (ri), b */
-      case 0x4b:
-#ifdef LOG_SVP
-        if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
+    entry = &trace->entry[trace->count++];
+    entry->pc = PC;
+    entry->op = op;
+    entry->handler = op_decode(op);
+#ifdef USE_DEBUGGER
+    debug(GET_PC(), op);
 #endif
-        read_P(); /* update P */
-        rA32 += rP.v; /* confirmed to be 32bit */
-        UPD_ACC_ZN /* ? */
-        rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
-        rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
-        break;
+    PC++;
+    entry->handler(op);
+  }
+  while ((--g_cycles > 0) && !(ssp->emu_status & SSP_WAIT_MASK) && (trace->count < SSP_CACHE_LENGTH));
+}
 
-      /* mld (rj), (ri), b */
-      case 0x5b:
-#ifdef LOG_SVP
-        if (!(op&0x100)) elprintf(EL_SVP|EL_ANOMALY, "ssp FIXME: no b bit @ %04x", GET_PPC_OFFS());
-#endif
-        rA32 = 0;
-        rST &= 0x0fff; /* ? */
-        rX = ptr1_read_(op&3, 0, (op<<1)&0x18); /* ri (maybe rj?) */
-        rY = ptr1_read_((op>>4)&3, 4, (op>>3)&0x18); /* rj */
-        break;
 
-      /* OP a, s */
-      case 0x10: OP_CHECK32(OP_SUBA32); tmpv = REG_READ(op & 0x0f); OP_SUBA(tmpv); break;
-      case 0x30: OP_CHECK32(OP_CMPA32); tmpv = REG_READ(op & 0x0f); OP_CMPA(tmpv); break;
-      case 0x40: OP_CHECK32(OP_ADDA32); tmpv = REG_READ(op & 0x0f); OP_ADDA(tmpv); break;
-      case 0x50: OP_CHECK32(OP_ANDA32); tmpv = REG_READ(op & 0x0f); OP_ANDA(tmpv); break;
-      case 0x60: OP_CHECK32(OP_ORA32 ); tmpv = REG_READ(op & 0x0f); OP_ORA (tmpv); break;
-      case 0x70: OP_CHECK32(OP_EORA32); tmpv = REG_READ(op & 0x0f); OP_EORA(tmpv); break;
-
-      /* OP a, (ri) */
-      case 0x11: tmpv = ptr1_read(op); OP_SUBA(tmpv); break;
-      case 0x31: tmpv = ptr1_read(op); OP_CMPA(tmpv); break;
-      case 0x41: tmpv = ptr1_read(op); OP_ADDA(tmpv); break;
-      case 0x51: tmpv = ptr1_read(op); OP_ANDA(tmpv); break;
-      case 0x61: tmpv = ptr1_read(op); OP_ORA (tmpv); break;
-      case 0x71: tmpv = ptr1_read(op); OP_EORA(tmpv); break;
-
-      /* OP a, adr */
-      case 0x03: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_LDA (tmpv); break;
-      case 0x13: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_SUBA(tmpv); break;
-      case 0x33: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_CMPA(tmpv); break;
-      case 0x43: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_ADDA(tmpv); break;
-      case 0x53: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_ANDA(tmpv); break;
-      case 0x63: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_ORA (tmpv); break;
-      case 0x73: tmpv = ssp->mem.RAM[op & 0x1ff]; OP_EORA(tmpv); break;
-
-      /* OP a, imm */
-      case 0x14: tmpv = *PC++; OP_SUBA(tmpv); break;
-      case 0x34: tmpv = *PC++; OP_CMPA(tmpv); break;
-      case 0x44: tmpv = *PC++; OP_ADDA(tmpv); break;
-      case 0x54: tmpv = *PC++; OP_ANDA(tmpv); break;
-      case 0x64: tmpv = *PC++; OP_ORA (tmpv); break;
-      case 0x74: tmpv = *PC++; OP_EORA(tmpv); break;
-
-      /* OP a, ((ri)) */
-      case 0x15: tmpv = ptr2_read(op); OP_SUBA(tmpv); break;
-      case 0x35: tmpv = ptr2_read(op); OP_CMPA(tmpv); break;
-      case 0x45: tmpv = ptr2_read(op); OP_ADDA(tmpv); break;
-      case 0x55: tmpv = ptr2_read(op); OP_ANDA(tmpv); break;
-      case 0x65: tmpv = ptr2_read(op); OP_ORA (tmpv); break;
-      case 0x75: tmpv = ptr2_read(op); OP_EORA(tmpv); break;
-
-      /* OP a, ri */
-      case 0x19: tmpv = rIJ[IJind]; OP_SUBA(tmpv); break;
-      case 0x39: tmpv = rIJ[IJind]; OP_CMPA(tmpv); break;
-      case 0x49: tmpv = rIJ[IJind]; OP_ADDA(tmpv); break;
-      case 0x59: tmpv = rIJ[IJind]; OP_ANDA(tmpv); break;
-      case 0x69: tmpv = rIJ[IJind]; OP_ORA (tmpv); break;
-      case 0x79: tmpv = rIJ[IJind]; OP_EORA(tmpv); break;
-
-      /* OP simm */
-      case 0x1c:
-        OP_SUBA(op & 0xff);
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
-      case 0x3c:
-        OP_CMPA(op & 0xff); 
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
-      case 0x4c:
-        OP_ADDA(op & 0xff);
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
-      /* MAME code only does LSB of top word, but this looks wrong to me. */
-      case 0x5c:
-        OP_ANDA(op & 0xff);
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
-      case 0x6c:
-        OP_ORA (op & 0xff);
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
-      case 0x7c:
-        OP_EORA(op & 0xff); 
-#ifdef LOG_SVP
-        if (op&0x100) elprintf(EL_SVP|EL_ANOMALY, "FIXME: simm with upper bit set");
-#endif
-        break;
+void ssp1601_run(int cycles)
+{
+  SET_PC(rPC);
+  g_cycles = cycles;
 
-      default:
-#ifdef LOG_SVP
-        elprintf(EL_ANOMALY|EL_SVP, "ssp FIXME unhandled op %04x @ %04x", op, GET_PPC_OFFS());
-#endif
-        break;
-    }
+  do
+  {
+    ssp_cache_execute();
   }
-  while (--g_cycles > 0 && !(ssp->emu_status & SSP_WAIT_MASK));
+  while ((g_cycles > 0) && !(ssp->emu_status & SSP_WAIT_MASK));
 
   read_P(); /* update P */
   rPC = GET_PC();
@@ -180,6 +180,53 @@ int cdc_context_load(uint8 *state)
   return bufferptr;
 }
 
+void cdc_dma_copy(uint8 *dst, unsigned int dst_index, unsigned int dst_mask, unsigned int words, int swap)
+{
+  /* CDC buffer source address */
+  unsigned int src_index = cdc.dac.w & 0x3ffe;
+
+  while (words)
+  {
+    /* contiguous words until source or destination address wraps */
+    unsigned int count = (0x4000 - src_index) >> 1;
+    if (count > ((dst_mask + 2 - dst_index) >> 1))
+    {
+      count = (dst_mask + 2 - dst_index) >> 1;
+    }
+    if (count > words)
+    {
+      count = words;
+    }
+
+#ifdef LSB_FIRST
+    if (swap)
+    {
+      /* source data is stored in big endian format */
+      uint16 *src = (uint16 *)(cdc.ram + src_index);
+      uint16 *ptr = (uint16 *)(dst + dst_index);
+      unsigned int i;
+
+      for (i=0; i<count; i++)
+      {
+        ptr[i] = (src[i] >> 8) | (src[i] << 8);
+      }
+    }
+    else
+#endif
+    {
+      memcpy(dst + dst_index, cdc.ram + src_index, count << 1);
+    }
+
+    /* increment CDC buffer source address */
+    src_index = (src_index + (count << 1)) & 0x3ffe;
+
+    /* increment destination address */
+    dst_index = (dst_index + (count << 1)) & dst_mask;
+
+    words -= count;
+  }
+}
+
 void cdc_dma_update(void)
 {
   /* maximal transfer length */
@@ -37,6 +37,21 @@
  ****************************************************************************************/
 #include "shared.h"
 
+#ifdef USE_CDZ
+#include "cdz.h"
+#endif
+
+#ifdef USE_CD_MMAP
+#include <sys/mman.h>
+#endif
+
+#ifdef USE_CD_READAHEAD
+#include <fcntl.h>
+
+/* number of CD blocks read ahead (one second at 1x speed) */
+#define CD_READAHEAD_BLOCKS 75
+#endif
+
 #ifdef USE_LIBTREMOR
 #define SUPPORTED_EXT 20
 #else
@@ -152,8 +167,270 @@ static const char extensions[SUPPORTED_EXT][16] =
 
 static blip_t* blip[2];
 
+/* CD-DA fader multipliers & output deltas (one frame max) */
+static int16 fader_mul[sizeof(cdc.ram) / 4];
+static int mix_delta[sizeof(cdc.ram) / 4];
+
+static int cdd_fader(int samples, int endVol)
+{
+  int i, mul;
+
+  /* current CD-DA fader volume */
+  int curVol = cdd.volume;
+
+  for (i=0; i<samples; i++)
+  {
+    /* CD-DA fader multiplier (cf. LC7883 datasheet) */
+    /* (MIN) 0,1,2,3,4,8,12,16,20...,1020,1024 (MAX) */
+    mul = (curVol & 0x7fc) ? (curVol & 0x7fc) : (curVol & 0x03);
+    fader_mul[i] = mul;
+
+    /* update CD-DA fader volume (one step/sample) */
+    if (curVol < endVol)
+    {
+      /* fade-in */
+      curVol++;
+    }
+    else if (curVol > endVol)
+    {
+      /* fade-out */
+      curVol--;
+    }
+    else if (!curVol)
+    {
+      /* audio will remain muted until next setup */
+      i++;
+      break;
+    }
+    else
+    {
+      /* constant volume for remaining samples */
+      while (++i < samples)
+      {
+        fader_mul[i] = mul;
+      }
+      break;
+    }
+  }
+
+  /* save current CD-DA fader volume */
+  cdd.volume = curVol;
+
+  /* number of processed samples */
+  return i;
+}
+
+static int cdd_mix(blip_t *buf, int16 *ptr, int count, int prev)
+{
+  int i;
+
+  if (count > 0)
+  {
+    /* 16-bit stereo samples are interleaved */
+    mix_delta[0] = ptr[0] - prev;
+    for (i=1; i<count; i++)
+    {
+      mix_delta[i] = ptr[i*2] - ptr[i*2-2];
+    }
+
+    blip_add_deltas_fast(buf, 0, mix_delta, count);
+
+    /* last audio output */
+    prev = ptr[count*2-2];
+  }
+
+  return prev;
+}
+
+#ifdef USE_CD_READAHEAD
+/* blocks currently being read ahead */
+static int readahead_index;
+static int readahead_start;
+static int readahead_end;
+
+static void cdd_readahead(void)
+{
+  track_t *track = &cdd.toc.tracks[cdd.index];
+  int size = cdd.index ? 2352 : cdd.sectorSize;
+  int pos;
+
+  /* still within first half of read-ahead blocks ? */
+  if ((cdd.index == readahead_index) && (cdd.lba >= readahead_start) && (cdd.lba < (readahead_end - CD_READAHEAD_BLOCKS / 2)))
+  {
+    return;
+  }
+
+  readahead_index = cdd.index;
+  readahead_start = cdd.lba;
+  readahead_end = cdd.lba + CD_READAHEAD_BLOCKS;
 
 #ifdef USE_LIBTREMOR
+  /* VORBIS file blocks can not be located without decoding */
+  if (track->vf.seekable)
+  {
+    return;
+  }
+#endif
+
+  if (track->fd)
+  {
+    /* let the system asynchronously load next blocks into its file cache (also used by mapped DATA track) */
+    pos = (cdd.lba * size) - track->offset;
+    posix_fadvise(fileno(track->fd), (pos > 0) ? pos : 0, CD_READAHEAD_BLOCKS * size, POSIX_FADV_WILLNEED);
+  }
+}
+#endif
+
+
+#ifdef USE_LIBTREMOR
+/* max. number of PCM samples decoded instead of seeking forward (one second) */
+#define OGG_SKIP_MAX 44100
+
+/* seek index resolution (in PCM samples) */
+#define OGG_INDEX_STEP 22050
+
+/* PCM samples possibly skipped by decoder when starting from a page (max. block size) */
+#define OGG_INDEX_MARGIN 4096
+
+/* seek index file header */
+static const char ogg_index_id[4] = {'G','P','X','1'};
+
+static void ogg_index(int index, char *filename)
+{
+  char fname[260];
+  unsigned char head[27 + 255];
+  uint32 size, offset, last = 0xffffffff;
+  ogg_int64_t granule, start = 0;
+  int i, len, max;
+  FILE *fd;
+
+  track_t *track = &cdd.toc.tracks[index];
+
+  /* VORBIS file size */
+  size = ov_raw_total(&track->vf, -1);
+
+  /* one entry per OGG_INDEX_STEP samples */
+  max = (ov_pcm_total(&track->vf, -1) / OGG_INDEX_STEP) + 1;
+  track->seek = malloc(max * sizeof(uint32));
+  if (!track->seek)
+  {
+    return;
+  }
+
+  /* seek index file is stored next to VORBIS file */
+  snprintf(fname, sizeof(fname), "%s.idx", filename);
+
+  /* try to load existing seek index */
+  fd = fopen(fname, "rb");
+  if (fd)
+  {
+    if ((fread(head, 12, 1, fd) == 1) && !memcmp(head, ogg_index_id, 4) &&
+        (*(uint32 *)(head + 4) == size) && (*(int32 *)(head + 8) == max) &&
+        (fread(track->seek, sizeof(uint32), max, fd) == max))
+    {
+      fclose(fd);
+      track->seek_len = max;
+      return;
+    }
+    fclose(fd);
+  }
+
+  /* scan VORBIS file pages */
+  fd = fopen(filename, "rb");
+  if (!fd)
+  {
+    free(track->seek);
+    track->seek = NULL;
+    return;
+  }
+
+  offset = 0;
+  while ((track->seek_len < max) && (fread(head, 27, 1, fd) == 1) && !memcmp(head, "OggS", 4))
+  {
+    /* page data length */
+    if (fread(head + 27, head[26], 1, fd) != 1) break;
+    for (i = 0, len = 0; i < head[26]; i++) len += head[27 + i];
+
+    /* decoding from this page should not output samples before current index position */
+    while ((start + OGG_INDEX_MARGIN) > ((ogg_int64_t)track->seek_len * OGG_INDEX_STEP))
+    {
+      track->seek[track->seek_len++] = last;
+      if (track->seek_len == max) break;
+    }
+    last = offset;
+
+    /* last complete sample of this page (64-bit little-endian granule position) */
+    for (i = 7, granule = 0; i >= 0; i--) granule = (granule << 8) | head[6 + i];
+    if (granule != -1) start = granule;
+
+    /* next page */
+    offset += 27 + head[26] + len;
+    fseek(fd, offset, SEEK_SET);
+  }
+
+  fclose(fd);
+
+  /* remaining entries */
+  while (track->seek_len < max)
+  {
+    track->seek[track->seek_len++] = last;
+  }
+
+  /* save seek index (a failure only means it will be rebuilt next time) */
+  fd = fopen(fname, "wb");
+  if (fd)
+  {
+    memcpy(head, ogg_index_id, 4);
+    *(uint32 *)(head + 4) = size;
+    *(int32 *)(head + 8) = max;
+    fwrite(head, 12, 1, fd);
+    fwrite(track->seek, sizeof(uint32), max, fd);
+    fclose(fd);
+  }
+}
+
+static void ogg_seek(track_t *track, ogg_int64_t pos)
+{
+  char buf[4096];
+  int len;
+
+  OggVorbis_File *vf = &track->vf;
+
+  /* PCM samples to skip */
+  ogg_int64_t skip = pos - ov_pcm_tell(vf);
+
+  /* long or backward seeks: jump to the VORBIS page given by seek index */
+  if (((skip < 0) || (skip > OGG_SKIP_MAX)) && (pos >= 0) && ((pos / OGG_INDEX_STEP) < track->seek_len) &&
+      (track->seek[pos / OGG_INDEX_STEP] != 0xffffffff))
+  {
+    if (!ov_raw_seek(vf, track->seek[pos / OGG_INDEX_STEP]))
+    {
+      skip = pos - ov_pcm_tell(vf);
+    }
+  }
+
+  /* short forward seeks (incl. seeks to current position) are faster to decode than to bisect through the stream */
+  if ((skip >= 0) && (skip <= OGG_SKIP_MAX))
+  {
+    while (skip > 0)
+    {
+      len = ov_read(vf, buf, (skip < (sizeof(buf) / 4)) ? (skip * 4) : sizeof(buf), 0);
+      if (len <= 0)
+      {
+        break;
+      }
+      skip -= len / 4;
+    }
+
+    if (!skip)
+    {
+      return;
+    }
+  }
+
+  ov_pcm_seek(vf, pos);
+}
+
 #ifdef DISABLE_MANY_OGG_OPEN_FILES
 static void ogg_free(int i)
 {
@@ -268,7 +545,7 @@ int cdd_context_load(uint8 *state)
     ov_open(cdd.toc.tracks[cdd.index].fd,&cdd.toc.tracks[cdd.index].vf,0,0);
 #endif
     /* VORBIS AUDIO track */
-    ov_pcm_seek(&cdd.toc.tracks[cdd.index].vf, (lba - cdd.toc.tracks[cdd.index].start) * 588 - cdd.toc.tracks[cdd.index].offset);
+    ogg_seek(&cdd.toc.tracks[cdd.index], (lba - cdd.toc.tracks[cdd.index].start) * 588 - cdd.toc.tracks[cdd.index].offset);
   }
 #endif
   else if (cdd.toc.tracks[cdd.index].fd)
@@ -287,6 +564,9 @@ int cdd_load(char *filename, char *header)
   char *ptr = 0;
   char *lptr = 0;
   FILE *fd;
+#ifdef USE_CDZ
+  FILE *cdz = 0;
+#endif
 
   /* first unmount any loaded disc */
   cdd_unload();
@@ -346,6 +626,17 @@ int cdd_load(char *filename, char *header)
       }
     }
   }
+#ifdef USE_CDZ
+  /* compressed CD image (all tracks are read from a single uncompressed BIN stream) */
+  else if (fd && ((cdz = cdz_open(fd)) != NULL))
+  {
+    /* initialize DATA track file descriptor */
+    cdd.toc.tracks[0].fd = cdz;
+
+    /* TOC is stored within image file */
+    fd = 0;
+  }
+#endif
   else
   {
     /* initialize DATA track file descriptor */
@@ -408,6 +699,17 @@ int cdd_load(char *filename, char *header)
   fseek(cdd.toc.tracks[0].fd, 0, SEEK_SET);
   cdd.toc.tracks[0].start = 0;
 
+#ifdef USE_CD_MMAP
+  /* map DATA track file so that sectors are read without any system call */
+  cdd.toc.tracks[0].size = cdd.toc.tracks[0].end * cdd.sectorSize;
+  cdd.toc.tracks[0].data = mmap(NULL, cdd.toc.tracks[0].size, PROT_READ, MAP_SHARED, fileno(cdd.toc.tracks[0].fd), 0);
+  if (cdd.toc.tracks[0].data == MAP_FAILED)
+  {
+    /* fall back to file reading */
+    cdd.toc.tracks[0].data = NULL;
+  }
+#endif
+
   /* initialize TOC */
   cdd.toc.end = cdd.toc.tracks[0].end;
   cdd.toc.last = 1;
@@ -600,6 +902,9 @@ int cdd_load(char *filename, char *header)
               break;
             }
 
+            /* build or load VORBIS file seek index */
+            ogg_index(cdd.toc.last, fname);
+
 #ifdef DISABLE_MANY_OGG_OPEN_FILES
             /* close VORBIS file structure to save memory */
             ogg_free(cdd.toc.last);
@@ -758,6 +1063,9 @@ int cdd_load(char *filename, char *header)
           cdd.toc.tracks[cdd.toc.last].end -= 150;
         }
 
+        /* build or load VORBIS file seek index */
+        ogg_index(cdd.toc.last, fname);
+
 #ifdef DISABLE_MANY_OGG_OPEN_FILES
         /* close VORBIS file structure to save memory */
         ogg_free(cdd.toc.last);
@@ -783,6 +1091,14 @@ int cdd_load(char *filename, char *header)
     }
   }
 
+#ifdef USE_CDZ
+  /* compressed CD image TOC */
+  if (cdz)
+  {
+    cdz_get_toc(&cdd.toc);
+  }
+#endif
+
   /* Simulate audio tracks if none found */
   if (cdd.toc.last == 1)
   {
@@ -893,6 +1209,14 @@ void cdd_unload(void)
   {
     int i;
 
+#ifdef USE_CD_MMAP
+    /* unmap DATA track file */
+    if (cdd.toc.tracks[0].data)
+    {
+      munmap(cdd.toc.tracks[0].data, cdd.toc.tracks[0].size);
+    }
+#endif
+
     /* close CD tracks */
     for (i=0; i<cdd.toc.last; i++)
     {
@@ -922,6 +1246,23 @@ void cdd_unload(void)
     cdd.loaded = 0;
   }
 
+#ifdef USE_CD_READAHEAD
+  /* reset read-ahead blocks */
+  readahead_start = readahead_end = 0;
+#endif
+
+#ifdef USE_LIBTREMOR
+  {
+    int i;
+
+    /* free VORBIS files seek index */
+    for (i=0; i<CD_MAX_TRACKS; i++)
+    {
+      free(cdd.toc.tracks[i].seek);
+    }
+  }
+#endif
+
   /* reset TOC */
   memset(&cdd.toc, 0x00, sizeof(cdd.toc));
     
@@ -934,6 +1275,16 @@ void cdd_read_data(uint8 *dst)
   /* only read DATA track sectors */
   if ((cdd.lba >= 0) && (cdd.lba < cdd.toc.tracks[0].end))
   {
+#ifdef USE_CD_MMAP
+    /* memory-mapped DATA track ? */
+    if (cdd.toc.tracks[0].data)
+    {
+      /* copy sector data (Mode 1 = 2048 bytes, skip 16-byte header in BIN format) */
+      memcpy(dst, cdd.toc.tracks[0].data + cdd.lba * cdd.sectorSize + ((cdd.sectorSize == 2352) ? 16 : 0), 2048);
+      return;
+    }
+#endif
+
     /* BIN format ? */
     if (cdd.sectorSize == 2352)
     {
@@ -958,10 +1309,10 @@ void cdd_read_audio(unsigned int samples)
   /* audio track playing ? */
   if (!scd.regs[0x36>>1].byte.h && cdd.toc.tracks[cdd.index].fd)
   {
-    int i, mul, delta;
+    int i, count;
 
-    /* current CD-DA fader volume */
-    int curVol = cdd.volume;
+    /* 16-bit (host-endian) stereo samples */
+    int16 *ptr = (int16 *) (cdc.ram);
 
     /* CD-DA fader volume setup (0-1024) */
     int endVol = scd.regs[0x34>>1].w >> 4;
@@ -971,7 +1322,6 @@ void cdd_read_audio(unsigned int samples)
     if (cdd.toc.tracks[cdd.index].vf.datasource)
     {
       int len, done = 0;
-      int16 *ptr = (int16 *) (cdc.ram);
       samples = samples * 4;
       while (done < samples)
       {
@@ -984,104 +1334,34 @@ void cdd_read_audio(unsigned int samples)
         done += len;
       }
       samples = done / 4;
-
-      /* process 16-bit (host-endian) stereo samples */
-      for (i=0; i<samples; i++)
-      {
-        /* CD-DA fader multiplier (cf. LC7883 datasheet) */
-        /* (MIN) 0,1,2,3,4,8,12,16,20...,1020,1024 (MAX) */
-        mul = (curVol & 0x7fc) ? (curVol & 0x7fc) : (curVol & 0x03);
-
-        /* left channel */
-        delta = ((ptr[0] * mul) / 1024) - l;
-        ptr++;
-        l += delta;
-        blip_add_delta_fast(blip[0], i, delta);
-
-        /* right channel */
-        delta = ((ptr[0] * mul) / 1024) - r;
-        ptr++;
-        r += delta;
-        blip_add_delta_fast(blip[1], i, delta);
-
-        /* update CD-DA fader volume (one step/sample) */
-        if (curVol < endVol)
-        {
-          /* fade-in */
-          curVol++;
-        }
-        else if (curVol > endVol)
-        {
-          /* fade-out */
-          curVol--;
-        }
-        else if (!curVol)
-        {
-          /* audio will remain muted until next setup */
-          break;
-        }
-      }
     }
     else
 #endif
     {
-#ifdef LSB_FIRST
-      int16 *ptr = (int16 *) (cdc.ram);
-#else
-      uint8 *ptr = cdc.ram;
-#endif
       fread(cdc.ram, 1, samples * 4, cdd.toc.tracks[cdd.index].fd);
 
-      /* process 16-bit (little-endian) stereo samples */
-      for (i=0; i<samples; i++)
+#ifndef LSB_FIRST
+      /* convert 16-bit (little-endian) samples to host-endian */
+      for (i=0; i<samples*2; i++)
       {
-        /* CD-DA fader multiplier (cf. LC7883 datasheet) */
-        /* (MIN) 0,1,2,3,4,8,12,16,20...,1020,1024 (MAX) */
-        mul = (curVol & 0x7fc) ? (curVol & 0x7fc) : (curVol & 0x03);
-
-        /* left channel */
-  #ifdef LSB_FIRST
-        delta = ((ptr[0] * mul) / 1024) - l;
-        ptr++;
-  #else
-        delta = (((int16)((ptr[0] + ptr[1]*256)) * mul) / 1024) - l;
-        ptr += 2;
-  #endif
-        l += delta;
-        blip_add_delta_fast(blip[0], i, delta);
-
-        /* right channel */
-  #ifdef LSB_FIRST
-        delta = ((ptr[0] * mul) / 1024) - r;
-        ptr++;
-  #else
-        delta = (((int16)((ptr[0] + ptr[1]*256)) * mul) / 1024) - r;
-        ptr += 2;
-  #endif
-        r += delta;
-        blip_add_delta_fast(blip[1], i, delta);
-
-        /* update CD-DA fader volume (one step/sample) */
-        if (curVol < endVol)
-        {
-          /* fade-in */
-          curVol++;
-        }
-        else if (curVol > endVol)
-        {
-          /* fade-out */
-          curVol--;
-        }
-        else if (!curVol)
-        {
-          /* audio will remain muted until next setup */
-          break;
-        }
+        ptr[i] = (int16)(cdc.ram[i*2] + cdc.ram[i*2+1]*256);
       }
+#endif
     }
 
-    /* save current CD-DA fader volume */
-    cdd.volume = curVol;
+    /* CD-DA fader multipliers (one volume step/sample) */
+    count = cdd_fader(samples, endVol);
+
+    /* apply CD-DA fader */
+    for (i=0; i<count; i++)
+    {
+      ptr[i*2]   = (ptr[i*2]   * fader_mul[i]) / 1024;
+      ptr[i*2+1] = (ptr[i*2+1] * fader_mul[i]) / 1024;
+    }
+
+    /* left & right channels output */
+    l = cdd_mix(blip[0], ptr, count, l);
+    r = cdd_mix(blip[1], ptr + 1, count, r);
 
     /* save last audio output for next frame */
     cdd.audio[0] = l;
@@ -1109,6 +1389,14 @@ void cdd_update(void)
 #ifdef LOG_CDD
   error("LBA = %d (track n%d)(latency=%d)\n", cdd.lba, cdd.index, cdd.latency);
 #endif
+
+#ifdef USE_CD_READAHEAD
+  /* prefetch next blocks while seeking or reading disc */
+  if ((cdd.status == CD_SEEK) || (cdd.status == CD_PLAY))
+  {
+    cdd_readahead();
+  }
+#endif
   
   /* seeking disc */
   if (cdd.status == CD_SEEK)
@@ -1196,7 +1484,7 @@ void cdd_update(void)
         /* VORBIS file need to be opened first */
         ov_open(cdd.toc.tracks[cdd.index].fd,&cdd.toc.tracks[cdd.index].vf,0,0);
 #endif
-        ov_pcm_seek(&cdd.toc.tracks[cdd.index].vf, -cdd.toc.tracks[cdd.index].offset);
+        ogg_seek(&cdd.toc.tracks[cdd.index], -cdd.toc.tracks[cdd.index].offset);
       }
       else
 #endif 
@@ -1295,7 +1583,7 @@ void cdd_update(void)
       }
 #endif
       /* VORBIS AUDIO track */
-      ov_pcm_seek(&cdd.toc.tracks[cdd.index].vf, (cdd.lba - cdd.toc.tracks[cdd.index].start) * 588 - cdd.toc.tracks[cdd.index].offset);
+      ogg_seek(&cdd.toc.tracks[cdd.index], (cdd.lba - cdd.toc.tracks[cdd.index].start) * 588 - cdd.toc.tracks[cdd.index].offset);
     }
 #endif 
     else if (cdd.toc.tracks[cdd.index].fd)
@@ -1514,7 +1802,7 @@ void cdd_process(void)
       else if (cdd.toc.tracks[index].vf.seekable)
       {
         /* VORBIS AUDIO track */
-        ov_pcm_seek(&cdd.toc.tracks[index].vf, (lba - cdd.toc.tracks[index].start) * 588 - cdd.toc.tracks[index].offset);
+        ogg_seek(&cdd.toc.tracks[index], (lba - cdd.toc.tracks[index].start) * 588 - cdd.toc.tracks[index].offset);
       }
 #endif 
       else if (cdd.toc.tracks[index].fd)
@@ -1606,7 +1894,7 @@ void cdd_process(void)
       else if (cdd.toc.tracks[index].vf.seekable)
       {
         /* VORBIS AUDIO track */
-        ov_pcm_seek(&cdd.toc.tracks[index].vf, (lba - cdd.toc.tracks[index].start) * 588 - cdd.toc.tracks[index].offset);
+        ogg_seek(&cdd.toc.tracks[index], (lba - cdd.toc.tracks[index].start) * 588 - cdd.toc.tracks[index].offset);
       }
 #endif 
       else if (cdd.toc.tracks[index].fd)
@@ -67,6 +67,12 @@ typedef struct
   FILE *fd;
 #ifdef USE_LIBTREMOR
   OggVorbis_File vf;
+  uint32 *seek;   /* VORBIS page file offsets (one per OGG_INDEX_STEP samples) */
+  int seek_len;
+#endif
+#ifdef USE_CD_MMAP
+  uint8 *data;  /* memory-mapped image file (DATA track only) */
+  int size;
 #endif
   int offset;
   int start;
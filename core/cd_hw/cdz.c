@@ -0,0 +1,324 @@
+/***************************************************************************************
+ *  Genesis Plus
+ *  Compressed CD image (.cdz) support
+ *
+ *  Redistribution and use of this code or any derivative works are permitted
+ *  provided that the following conditions are met:
+ *
+ *   - Redistributions may not be sold, nor may they be used in a commercial
+ *     product or activity.
+ *
+ *   - Redistributions that are modified from the original source must include the
+ *     complete source code, including the source code for all components used by a
+ *     binary built from the modified sources. However, as a special exception, the
+ *     source code distributed need not include anything that is normally distributed
+ *     (in either source or binary form) with the major components (compiler, kernel,
+ *     and so on) of the operating system on which the executable runs, unless that
+ *     component itself accompanies the executable.
+ *
+ *   - Redistributions must reproduce the above copyright notice, this list of
+ *     conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************/
+#ifdef USE_CDZ
+
+#define _GNU_SOURCE
+#include "shared.h"
+#include "cdz.h"
+#include <zlib.h>
+
+/* compressed CD image */
+static struct
+{
+  FILE *fd;
+  uint32 hunk_size;
+  uint32 sectors;
+  uint32 tracks;
+  uint32 hunks;
+  uint32 *offsets;
+  uint32 *toc;
+  long pos;
+  uint32 clock;
+  struct
+  {
+    int hunk;
+    uint32 last;
+    uint8 *data;
+  } cache[CDZ_MAX_HUNKS_CACHED];
+} cdz;
+
+static uint32 read_le32(const uint8 *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32)p[3] << 24);
+}
+
+static uint8 *cdz_hunk(int hunk)
+{
+  int i, lru = 0;
+  uLongf len = cdz.hunk_size;
+  uint32 size;
+  uint8 *src;
+
+  if ((hunk < 0) || (hunk >= (int)cdz.hunks))
+  {
+    return NULL;
+  }
+
+  /* compressed hunk length (validated on open) */
+  size = cdz.offsets[hunk + 1] - cdz.offsets[hunk];
+
+  /* look for hunk in cache (or least recently used entry) */
+  for (i=0; i<CDZ_MAX_HUNKS_CACHED; i++)
+  {
+    if (cdz.cache[i].hunk == hunk)
+    {
+      cdz.cache[i].last = ++cdz.clock;
+      return cdz.cache[i].data;
+    }
+
+    if (cdz.cache[i].last < cdz.cache[lru].last)
+    {
+      lru = i;
+    }
+  }
+
+  /* read hunk data */
+  src = malloc(size);
+  if (!src)
+  {
+    return NULL;
+  }
+
+  fseek(cdz.fd, cdz.offsets[hunk], SEEK_SET);
+  if (fread(src, size, 1, cdz.fd) != 1)
+  {
+    free(src);
+    return NULL;
+  }
+
+  /* decompress hunk into least recently used entry */
+  if (size == cdz.hunk_size)
+  {
+    memcpy(cdz.cache[lru].data, src, size);
+  }
+  else if ((uncompress(cdz.cache[lru].data, &len, src, size) != Z_OK) || (len != cdz.hunk_size))
+  {
+    free(src);
+    cdz.cache[lru].hunk = -1;
+    cdz.cache[lru].last = 0;
+    return NULL;
+  }
+
+  free(src);
+  cdz.cache[lru].hunk = hunk;
+  cdz.cache[lru].last = ++cdz.clock;
+  return cdz.cache[lru].data;
+}
+
+static ssize_t cdz_read(void *cookie, char *buf, size_t size)
+{
+  long end = (long)cdz.sectors * 2352;
+  size_t done = 0;
+
+  while ((done < size) && (cdz.pos < end))
+  {
+    /* current hunk */
+    int hunk = cdz.pos / cdz.hunk_size;
+    int offset = cdz.pos % cdz.hunk_size;
+    int len = cdz.hunk_size - offset;
+    uint8 *data = cdz_hunk(hunk);
+    if (!data)
+    {
+      break;
+    }
+
+    /* last hunk is not complete */
+    if (len > (end - cdz.pos))
+    {
+      len = end - cdz.pos;
+    }
+
+    if (len > (size - done))
+    {
+      len = size - done;
+    }
+
+    memcpy(buf + done, data + offset, len);
+    cdz.pos += len;
+    done += len;
+  }
+
+  return done;
+}
+
+static int cdz_seek(void *cookie, off64_t *offset, int whence)
+{
+  long pos = *offset;
+
+  switch (whence)
+  {
+    case SEEK_CUR:
+      pos += cdz.pos;
+      break;
+
+    case SEEK_END:
+      pos += (long)cdz.sectors * 2352;
+      break;
+  }
+
+  if (pos < 0)
+  {
+    return -1;
+  }
+
+  *offset = cdz.pos = pos;
+  return 0;
+}
+
+static void cdz_free(void)
+{
+  int i;
+
+  for (i=0; i<CDZ_MAX_HUNKS_CACHED; i++)
+  {
+    free(cdz.cache[i].data);
+  }
+
+  free(cdz.offsets);
+  free(cdz.toc);
+  memset(&cdz, 0, sizeof(cdz));
+}
+
+static int cdz_close(void *cookie)
+{
+  fclose(cdz.fd);
+  cdz_free();
+  return 0;
+}
+
+FILE *cdz_open(FILE *fd)
+{
+  cookie_io_functions_t io = { cdz_read, NULL, cdz_seek, cdz_close };
+  uint8 head[16];
+  uint8 *buf;
+  uint32 i, hunks;
+
+  /* check file identifier */
+  fseek(fd, 0, SEEK_SET);
+  if ((fread(head, 16, 1, fd) != 1) || memcmp(head, "CDZ1", 4))
+  {
+    fseek(fd, 0, SEEK_SET);
+    return NULL;
+  }
+
+  /* only one compressed CD image can be opened */
+  if (cdz.fd)
+  {
+    return NULL;
+  }
+
+  /* hunk length and image size (in sectors) should not overflow */
+  cdz.hunk_size = read_le32(head + 4);
+  cdz.sectors = read_le32(head + 8);
+  cdz.tracks = read_le32(head + 12);
+  if (!cdz.hunk_size || (cdz.hunk_size > (0x7fffffff / 2352)) || !cdz.sectors || (cdz.sectors > (0x7fffffff / 2352)) || !cdz.tracks || (cdz.tracks >= CD_MAX_TRACKS))
+  {
+    cdz_free();
+    return NULL;
+  }
+
+  /* read TOC and hunk offsets */
+  hunks = (cdz.sectors + cdz.hunk_size - 1) / cdz.hunk_size;
+  cdz.hunk_size *= 2352;
+  cdz.hunks = hunks;
+  buf = malloc((cdz.tracks * 2 + hunks + 1) * 4);
+  cdz.toc = malloc(cdz.tracks * 2 * sizeof(uint32));
+  cdz.offsets = malloc((hunks + 1) * sizeof(uint32));
+  if (!buf || !cdz.toc || !cdz.offsets || (fread(buf, (cdz.tracks * 2 + hunks + 1) * 4, 1, fd) != 1))
+  {
+    free(buf);
+    cdz_free();
+    return NULL;
+  }
+
+  for (i=0; i<cdz.tracks*2; i++)
+  {
+    cdz.toc[i] = read_le32(buf + i * 4);
+  }
+
+  for (i=0; i<=hunks; i++)
+  {
+    cdz.offsets[i] = read_le32(buf + (cdz.tracks * 2 + i) * 4);
+  }
+
+  free(buf);
+
+  /* tracks should be ordered and within image */
+  for (i=0; i<cdz.tracks; i++)
+  {
+    if ((cdz.toc[i * 2] > cdz.toc[i * 2 + 1]) || (cdz.toc[i * 2 + 1] > cdz.sectors) || (i && (cdz.toc[i * 2] < cdz.toc[i * 2 - 1])))
+    {
+      cdz_free();
+      return NULL;
+    }
+  }
+
+  /* hunks should be ordered and not larger than uncompressed */
+  for (i=0; i<hunks; i++)
+  {
+    if ((cdz.offsets[i] > cdz.offsets[i + 1]) || ((cdz.offsets[i + 1] - cdz.offsets[i]) > cdz.hunk_size))
+    {
+      cdz_free();
+      return NULL;
+    }
+  }
+
+  /* allocate decompressed hunks cache */
+  for (i=0; i<CDZ_MAX_HUNKS_CACHED; i++)
+  {
+    cdz.cache[i].hunk = -1;
+    cdz.cache[i].data = malloc(cdz.hunk_size);
+    if (!cdz.cache[i].data)
+    {
+      cdz_free();
+      return NULL;
+    }
+  }
+
+  cdz.fd = fd;
+  cdz.pos = 0;
+
+  /* uncompressed CD image is accessed as a single BIN file */
+  return fopencookie(&cdz, "rb", io);
+}
+
+void cdz_get_toc(toc_t *toc)
+{
+  uint32 i;
+
+  for (i=0; i<cdz.tracks; i++)
+  {
+    toc->tracks[i].start = cdz.toc[i * 2];
+    toc->tracks[i].end = cdz.toc[i * 2 + 1];
+    toc->tracks[i].offset = 0;
+    toc->tracks[i].fd = toc->tracks[0].fd;
+  }
+
+  toc->last = cdz.tracks;
+  toc->end = toc->tracks[cdz.tracks - 1].end;
+}
+
+#endif
@@ -0,0 +1,60 @@
+/***************************************************************************************
+ *  Genesis Plus
+ *  Compressed CD image (.cdz) support
+ *
+ *  Redistribution and use of this code or any derivative works are permitted
+ *  provided that the following conditions are met:
+ *
+ *   - Redistributions may not be sold, nor may they be used in a commercial
+ *     product or activity.
+ *
+ *   - Redistributions that are modified from the original source must include the
+ *     complete source code, including the source code for all components used by a
+ *     binary built from the modified sources. However, as a special exception, the
+ *     source code distributed need not include anything that is normally distributed
+ *     (in either source or binary form) with the major components (compiler, kernel,
+ *     and so on) of the operating system on which the executable runs, unless that
+ *     component itself accompanies the executable.
+ *
+ *   - Redistributions must reproduce the above copyright notice, this list of
+ *     conditions and the following disclaimer in the documentation and/or other
+ *     materials provided with the distribution.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ *  AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ *  IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ *  ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ *  LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ *  CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ *  SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ *  INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ *  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************/
+#ifndef _HW_CDZ_
+#define _HW_CDZ_
+
+/*
+  CDZ file layout (all values are 32-bit little-endian):
+
+    "CDZ1"                  file identifier
+    hunk length             number of 2352-byte sectors per hunk
+    sectors                 total number of sectors (LBA 0 to end of last track)
+    tracks                  number of tracks (track 1 is the DATA track)
+    start, end  (x tracks)  track start & end sectors
+    offsets (x hunks + 1)   hunk data file offsets
+
+  Each hunk is compressed independently with zlib, hunks which do not compress
+  are stored as is (compressed length equals hunk length). Sectors are stored
+  in raw (BIN) format, including DATA track sector headers and CD-DA samples.
+*/
+
+#define CDZ_MAX_HUNKS_CACHED 16
+
+/* Function prototypes */
+extern FILE *cdz_open(FILE *fd);
+extern void cdz_get_toc(toc_t *toc);
+
+#endif
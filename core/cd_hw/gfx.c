@@ -43,116 +43,50 @@
 
 void word_ram_0_dma_w(unsigned int words)
 {
-  uint16 data;
-
-  /* CDC buffer source address */
-  uint16 src_index = cdc.dac.w & 0x3ffe;
-  
   /* WORD-RAM destination address*/
   uint32 dst_index = (scd.regs[0x0a>>1].w << 3) & 0x1fffe;
   
   /* update DMA destination address */
   scd.regs[0x0a>>1].w += (words >> 2);
 
-  /* update DMA source address */
-  cdc.dac.w += (words << 1);
-
   /* DMA transfer */
-  while (words--)
-  {
-    /* read 16-bit word from CDC buffer */
-    data = *(uint16 *)(cdc.ram + src_index);
-
-#ifdef LSB_FIRST
-    /* source data is stored in big endian format */
-    data = ((data >> 8) | (data << 8)) & 0xffff;
-#endif
-
-    /* write 16-bit word to WORD-RAM */
-    *(uint16 *)(scd.word_ram[0] + dst_index) = data ;
-
-    /* increment CDC buffer source address */
-    src_index = (src_index + 2) & 0x3ffe;
+  cdc_dma_copy(scd.word_ram[0], dst_index, 0x1fffe, words, 1);
 
-    /* increment WORD-RAM destination address */
-    dst_index = (dst_index + 2) & 0x1fffe;
-  }
+  /* update DMA source address */
+  cdc.dac.w += (words << 1);
 }
 
 void word_ram_1_dma_w(unsigned int words)
 {
-  uint16 data;
-
-  /* CDC buffer source address */
-  uint16 src_index = cdc.dac.w & 0x3ffe;
-  
   /* WORD-RAM destination address*/
-  uint32 dst_index = ((scd.regs[0x0a>>1].w << 3) & 0x1fffe);
+  uint32 dst_index = (scd.regs[0x0a>>1].w << 3) & 0x1fffe;
   
   /* update DMA destination address */
   scd.regs[0x0a>>1].w += (words >> 2);
 
-  /* update DMA source address */
-  cdc.dac.w += (words << 1);
-
   /* DMA transfer */
-  while (words--)
-  {
-    /* read 16-bit word from CDC buffer */
-    data = *(uint16 *)(cdc.ram + src_index);
-
-#ifdef LSB_FIRST
-    /* source data is stored in big endian format */
-    data = ((data >> 8) | (data << 8)) & 0xffff;
-#endif
-
-    /* write 16-bit word to WORD-RAM */
-    *(uint16 *)(scd.word_ram[1] + dst_index) = data ;
+  cdc_dma_copy(scd.word_ram[1], dst_index, 0x1fffe, words, 1);
 
-    /* increment CDC buffer source address */
-    src_index = (src_index + 2) & 0x3ffe;
-
-    /* increment WORD-RAM destination address */
-    dst_index = (dst_index + 2) & 0x1fffe;
-  }
+  /* update DMA source address */
+  cdc.dac.w += (words << 1);
 }
 
 void word_ram_2M_dma_w(unsigned int words)
 {
-  uint16 data;
-
-  /* CDC buffer source address */
-  uint16 src_index = cdc.dac.w & 0x3ffe;
-  
   /* WORD-RAM destination address*/
   uint32 dst_index = (scd.regs[0x0a>>1].w << 3) & 0x3fffe;
   
+  /* render pending image lines first */
+  gfx_flush();
+
   /* update DMA destination address */
   scd.regs[0x0a>>1].w += (words >> 2);
 
-  /* update DMA source address */
-  cdc.dac.w += (words << 1);
-
   /* DMA transfer */
-  while (words--)
-  {
-    /* read 16-bit word from CDC buffer */
-    data = *(uint16 *)(cdc.ram + src_index);
+  cdc_dma_copy(scd.word_ram_2M, dst_index, 0x3fffe, words, 1);
 
-#ifdef LSB_FIRST
-    /* source data is stored in big endian format */
-    data = ((data >> 8) | (data << 8)) & 0xffff;
-#endif
-
-    /* write 16-bit word to WORD-RAM */
-    *(uint16 *)(scd.word_ram_2M + dst_index) = data ;
-
-    /* increment CDC buffer source address */
-    src_index = (src_index + 2) & 0x3ffe;
-
-    /* increment WORD-RAM destination address */
-    dst_index = (dst_index + 2) & 0x3fffe;
-  }
+  /* update DMA source address */
+  cdc.dac.w += (words << 1);
 }
 
 
@@ -308,6 +242,45 @@ void cell_ram_1_write8(unsigned int address, unsigned int data)
 /*      Rotation / Scaling operation (2M Mode)                 */
 /***************************************************************/
 
+/* SUB-CPU Word-RAM accesses while image lines are pending (render them first) */
+static unsigned int gfx_ram_read8(unsigned int address)
+{
+  gfx_flush();
+  return READ_BYTE(scd.word_ram_2M, address & 0x3ffff);
+}
+
+static unsigned int gfx_ram_read16(unsigned int address)
+{
+  gfx_flush();
+  return *(uint16 *)(scd.word_ram_2M + (address & 0x3fffe));
+}
+
+static void gfx_ram_write8(unsigned int address, unsigned int data)
+{
+  gfx_flush();
+  WRITE_BYTE(scd.word_ram_2M, address & 0x3ffff, data);
+}
+
+static void gfx_ram_write16(unsigned int address, unsigned int data)
+{
+  gfx_flush();
+  *(uint16 *)(scd.word_ram_2M + (address & 0x3fffe)) = data;
+}
+
+static void gfx_ram_trap(int enable)
+{
+  int i;
+
+  /* $080000-$0BFFFF: Word-RAM in 2M mode (256KB) */
+  for (i=0x08; i<0x0c; i++)
+  {
+    s68k.memory_map[i].read8   = enable ? gfx_ram_read8 : NULL;
+    s68k.memory_map[i].read16  = enable ? gfx_ram_read16 : NULL;
+    s68k.memory_map[i].write8  = enable ? gfx_ram_write8 : NULL;
+    s68k.memory_map[i].write16 = enable ? gfx_ram_write16 : NULL;
+  }
+}
+
 void gfx_init(void)
 {
   int i, j;
@@ -421,6 +394,13 @@ void gfx_init(void)
 
 void gfx_reset(void)
 { 
+  /* Discard pending image lines */
+  if (gfx.pending)
+  {
+    gfx.pending = 0;
+    gfx_ram_trap(0);
+  }
+
   /* Reset cycle counter */
   gfx.cycles = 0;
 }
@@ -430,6 +410,9 @@ int gfx_context_save(uint8 *state)
   uint32 tmp32;
   int bufferptr = 0;
 
+  /* pending image lines are not saved */
+  gfx_flush();
+
   save_param(&gfx.cycles, sizeof(gfx.cycles));
   save_param(&gfx.cyclesPerLine, sizeof(gfx.cyclesPerLine));
   save_param(&gfx.dotMask, sizeof(gfx.dotMask));
@@ -466,14 +449,29 @@ int gfx_context_load(uint8 *state)
   load_param(&tmp32, 4);
   gfx.mapPtr = (uint16 *)(scd.word_ram_2M + tmp32);
 
+  /* discard pending image lines */
+  if (gfx.pending)
+  {
+    gfx.pending = 0;
+    gfx_ram_trap(0);
+  }
+
   return bufferptr;
 }
 
+/* number of dots processed at once */
+#define GFX_DOTS 8
+
 INLINE void gfx_render(uint32 bufferIndex, uint32 width)
 {
   uint8 pixel_in, pixel_out;
   uint16 stamp_data;
-  uint32 stamp_index;
+  uint32 stamp_index, i, count;
+
+  /* dot positions & pixels of current block */
+  uint32 xpos_blk[GFX_DOTS];
+  uint32 ypos_blk[GFX_DOTS];
+  uint8 pixel_blk[GFX_DOTS];
 
   /* pixel map start position for current line (13.3 format converted to 13.11) */
   uint32 xpos = *gfx.tracePtr++ << 8;
@@ -483,116 +481,145 @@ INLINE void gfx_render(uint32 bufferIndex, uint32 width)
   uint32 xoffset = (int16) *gfx.tracePtr++;
   uint32 yoffset = (int16) *gfx.tracePtr++;
 
-  /* process all dots */
-  while (width--)
+  /* stamp map parameters (kept local as they could otherwise be reloaded after each byte write) */
+  uint32 dotMask = gfx.dotMask;
+  uint16 *mapPtr = gfx.mapPtr;
+  uint32 stampShift = gfx.stampShift;
+  uint32 mapShift = gfx.mapShift;
+  uint32 bufferOffset = gfx.bufferOffset;
+
+  /* stamp map range if stamp map is repeated, 24-bit range otherwise */
+  uint32 posMask = (scd.regs[0x58>>1].byte.l & 0x01) ? dotMask : 0xffffff;
+
+  /* stamp size (0=16x16, 1=32x32) */
+  uint32 stampSize = (scd.regs[0x58>>1].byte.l & 0x02) << 2;
+
+  /* priority mode write lookup table */
+  uint8 (*lut_prio)[0x100] = gfx.lut_prio[(scd.regs[0x02>>1].w >> 3) & 0x03];
+
+  /* last accessed stamp cell (8x8 dots) */
+  uint32 cell = 0xffffffff;
+  uint32 cell_index = 0;
+  uint32 cell_flags = 0;
+
+  /* process dots by blocks */
+  while (width)
   {
-    /* check if stamp map is repeated */
-    if (scd.regs[0x58>>1].byte.l & 0x01)
-    {
-      /* stamp map range */
-      xpos &= gfx.dotMask;
-      ypos &= gfx.dotMask;
-    }
-    else
-    {
-      /* 24-bit range */
-      xpos &= 0xffffff;
-      ypos &= 0xffffff;
-    }
+    count = (width < GFX_DOTS) ? width : GFX_DOTS;
+    width -= count;
 
-    /* check if pixel is outside stamp map */
-    if ((xpos | ypos) & ~gfx.dotMask)
+    /* pixel positions (masking each position is equivalent to masking accumulated values) */
+    for (i=0; i<count; i++)
     {
-      /* force pixel output to 0 */
-      pixel_out = 0x00;
+      xpos_blk[i] = (xpos + i * xoffset) & posMask;
+      ypos_blk[i] = (ypos + i * yoffset) & posMask;
     }
-    else
+
+    /* increment pixel position */
+    xpos += count * xoffset;
+    ypos += count * yoffset;
+
+    /* read stamp pixels */
+    for (i=0; i<count; i++)
     {
-      /* read stamp map table data */
-      stamp_data = gfx.mapPtr[(xpos >> gfx.stampShift) | ((ypos >> gfx.stampShift) << gfx.mapShift)];
-
-      /* stamp generator base index                                     */
-      /* sss ssssssss ccyyyxxx (16x16) or sss sssssscc ccyyyxxx (32x32) */
-      /* with:  s = stamp number (1 stamp = 16x16 or 32x32 pixels)      */
-      /*        c = cell offset  (0-3 for 16x16, 0-15 for 32x32)        */
-      /*      yyy = line offset  (0-7)                                  */
-      /*      xxx = pixel offset (0-7)                                  */
-      stamp_index = (stamp_data & 0x7ff) << 8;
-
-      if (stamp_index)
+      /* check if pixel is outside stamp map */
+      if ((xpos_blk[i] | ypos_blk[i]) & ~dotMask)
+      {
+        /* force pixel output to 0 */
+        pixel_blk[i] = 0x00;
+        continue;
+      }
+
+      /* stamp map data & cell offset only change when a new cell is accessed */
+      if (cell != ((xpos_blk[i] >> 14) | ((ypos_blk[i] >> 14) << 16)))
       {
+        cell = (xpos_blk[i] >> 14) | ((ypos_blk[i] >> 14) << 16);
+
+        /* read stamp map table data */
+        stamp_data = mapPtr[(xpos_blk[i] >> stampShift) | ((ypos_blk[i] >> stampShift) << mapShift)];
+
+        /* stamp generator base index                                     */
+        /* sss ssssssss ccyyyxxx (16x16) or sss sssssscc ccyyyxxx (32x32) */
+        /* with:  s = stamp number (1 stamp = 16x16 or 32x32 pixels)      */
+        /*        c = cell offset  (0-3 for 16x16, 0-15 for 32x32)        */
+        /*      yyy = line offset  (0-7)                                  */
+        /*      xxx = pixel offset (0-7)                                  */
+        cell_index = (stamp_data & 0x7ff) << 8;
+
         /* extract HFLIP & ROTATION bits */
-        stamp_data = (stamp_data >> 13) & 7;
-
-        /* cell offset (0-3 or 0-15)                             */
-        /* table entry = yyxxshrr (8 bits)                       */
-        /* with: yy = cell row  (0-3) = (ypos >> (11 + 3)) & 3   */
-        /*       xx = cell column (0-3) = (xpos >> (11 + 3)) & 3 */
-        /*        s = stamp size (0=16x16, 1=32x32)              */
-        /*      hrr = HFLIP & ROTATION bits                      */
-        stamp_index |= gfx.lut_cell[stamp_data | ((scd.regs[0x58>>1].byte.l & 0x02) << 2 ) | ((ypos >> 8) & 0xc0) | ((xpos >> 10) & 0x30)] << 6;
-            
+        cell_flags = (stamp_data >> 13) & 7;
+
+        /* stamp 0 is not used */
+        if (cell_index)
+        {
+          /* cell offset (0-3 or 0-15)                             */
+          /* table entry = yyxxshrr (8 bits)                       */
+          /* with: yy = cell row  (0-3) = (ypos >> (11 + 3)) & 3   */
+          /*       xx = cell column (0-3) = (xpos >> (11 + 3)) & 3 */
+          /*        s = stamp size (0=16x16, 1=32x32)              */
+          /*      hrr = HFLIP & ROTATION bits                      */
+          cell_index |= gfx.lut_cell[cell_flags | stampSize | ((ypos_blk[i] >> 8) & 0xc0) | ((xpos_blk[i] >> 10) & 0x30)] << 6;
+        }
+      }
+
+      if (cell_index)
+      {
         /* pixel  offset (0-63)                              */
         /* table entry = yyyxxxhrr (9 bits)                  */
         /* with: yyy = pixel row  (0-7) = (ypos >> 11) & 7   */
         /*       xxx = pixel column (0-7) = (xpos >> 11) & 7 */
         /*       hrr = HFLIP & ROTATION bits                 */
-        stamp_index |= gfx.lut_pixel[stamp_data | ((xpos >> 8) & 0x38) | ((ypos >> 5) & 0x1c0)];
-
-        /* read pixel pair (2 pixels/byte) */
-        pixel_out = READ_BYTE(scd.word_ram_2M, stamp_index >> 1);
+        stamp_index = cell_index | gfx.lut_pixel[cell_flags | ((xpos_blk[i] >> 8) & 0x38) | ((ypos_blk[i] >> 5) & 0x1c0)];
 
-        /* extract left or rigth pixel */
-        if (stamp_index & 1)
-        {
-           pixel_out &= 0x0f;
-        }
-        else
-        {
-           pixel_out >>= 4;
-        }
+        /* read pixel pair (2 pixels/byte) and extract left or rigth pixel */
+        pixel_blk[i] = (READ_BYTE(scd.word_ram_2M, stamp_index >> 1) >> ((~stamp_index & 1) << 2)) & 0x0f;
       }
       else
       {
         /* stamp 0 is not used: force pixel output to 0 */
-        pixel_out = 0x00;
+        pixel_blk[i] = 0x00;
       }
     }
 
-    /* read out paired pixel data */
-    pixel_in = READ_BYTE(scd.word_ram_2M, bufferIndex >> 1);
-
-    /* update left or rigth pixel */
-    if (bufferIndex & 1)
-    {
-      pixel_out |= (pixel_in & 0xf0);
-    }
-    else
+    /* write pixels to image buffer */
+    for (i=0; i<count; i++)
     {
-      pixel_out = (pixel_out << 4) | (pixel_in & 0x0f);
-    }
+      /* read out paired pixel data */
+      pixel_in = READ_BYTE(scd.word_ram_2M, bufferIndex >> 1);
 
-    /* priority mode write */
-    pixel_out = gfx.lut_prio[(scd.regs[0x02>>1].w >> 3) & 0x03][pixel_in][pixel_out];
+      if (bufferIndex & 1)
+      {
+        /* update rigth pixel */
+        pixel_out = pixel_blk[i] | (pixel_in & 0xf0);
+      }
+      else if ((i + 1) < count)
+      {
+        /* update both pixels (priority mode is applied separately on each pixel) */
+        pixel_out = (pixel_blk[i] << 4) | pixel_blk[i + 1];
+        bufferIndex++;
+        i++;
+      }
+      else
+      {
+        /* update left pixel */
+        pixel_out = (pixel_blk[i] << 4) | (pixel_in & 0x0f);
+      }
 
-    /* write data to image buffer */
-    WRITE_BYTE(scd.word_ram_2M, bufferIndex >> 1, pixel_out);
+      /* priority mode write */
+      WRITE_BYTE(scd.word_ram_2M, bufferIndex >> 1, lut_prio[pixel_in][pixel_out]);
 
-    /* check current pixel position  */
-    if ((bufferIndex & 7) != 7)
-    {
-      /* next pixel */
-      bufferIndex++;
-    }
-    else
-    {
-      /* next cell: increment image buffer offset by one column (minus 7 pixels) */
-      bufferIndex += gfx.bufferOffset;
+      /* check current pixel position  */
+      if ((bufferIndex & 7) != 7)
+      {
+        /* next pixel */
+        bufferIndex++;
+      }
+      else
+      {
+        /* next cell: increment image buffer offset by one column (minus 7 pixels) */
+        bufferIndex += bufferOffset;
+      }
     }
-
-    /* increment pixel position */
-    xpos += xoffset;
-    ypos += yoffset;
   }
 }
 
@@ -703,6 +730,29 @@ void gfx_update(int cycles)
       }
     }
 
+    /* image lines are only rendered when needed in 2M mode */
+    if (!(scd.regs[0x02>>1].byte.l & 0x04))
+    {
+      if (lines)
+      {
+        /* trap SUB-CPU Word-RAM accesses */
+        if (!gfx.pending)
+        {
+          gfx_ram_trap(1);
+        }
+
+        gfx.pending += lines;
+      }
+
+      /* all lines are rendered at the end of graphics operation */
+      if (!scd.regs[0x58>>1].byte.h)
+      {
+        gfx_flush();
+      }
+
+      return;
+    }
+
     /* render lines */
     while (lines--)
     {
@@ -714,3 +764,23 @@ void gfx_update(int cycles)
     }
   }
 }
+
+void gfx_flush(void)
+{
+  if (gfx.pending)
+  {
+    /* render pending lines */
+    do
+    {
+      /* process dots to image buffer */
+      gfx_render(gfx.bufferStart, scd.regs[0x62>>1].w);
+
+      /* increment image buffer start index for next line (8 pixels/line) */
+      gfx.bufferStart += 8;
+    }
+    while (--gfx.pending);
+
+    /* restore SUB-CPU Word-RAM direct access */
+    gfx_ram_trap(0);
+  }
+}
@@ -51,6 +51,7 @@ typedef struct
   uint8 mapShift;                   /* stamp map table shift value (related to stamp map size) */
   uint16 bufferOffset;              /* image buffer column offset */
   uint32 bufferStart;               /* image buffer start index */
+  uint32 pending;                   /* image lines waiting to be rendered */
   uint16 lut_offset[0x8000];        /* Cell Image -> WORD-RAM offset lookup table (1M Mode) */
   uint8 lut_prio[4][0x100][0x100];  /* WORD-RAM data writes priority lookup table */
   uint8 lut_pixel[0x200];           /* Graphics operation dot offset lookup table */
@@ -112,5 +113,6 @@ extern int gfx_context_save(uint8 *state);
 extern int gfx_context_load(uint8 *state);
 extern void gfx_start(unsigned int base, int cycles);
 extern void gfx_update(int cycles);
+extern void gfx_flush(void);
 
 #endif
@@ -409,34 +409,16 @@ unsigned char pcm_read(unsigned int address)
 
 void pcm_ram_dma_w(unsigned int words)
 {
-  uint16 data;
-
-  /* CDC buffer source address */
-  uint16 src_index = cdc.dac.w & 0x3ffe;
-  
   /* PCM-RAM destination address*/
   uint16 dst_index = (scd.regs[0x0a>>1].w << 2) & 0xffe;
   
   /* update DMA destination address */
   scd.regs[0x0a>>1].w += (words >> 1);
 
+  /* DMA transfer (endianness does not matter since PCM RAM is always accessed as byte) */
+  cdc_dma_copy(pcm.bank, dst_index, 0xffe, words, 0);
+
   /* update DMA source address */
   cdc.dac.w += (words << 1);
-
-  /* DMA transfer */
-  while (words--)
-  {
-    /* read 16-bit word from CDC buffer */
-    data = *(uint16 *)(cdc.ram + src_index);
-
-    /* write 16-bit word to PCM RAM (endianness does not matter since PCM RAM is always accessed as byte)*/
-    *(uint16 *)(pcm.bank + dst_index) = data ;
-
-    /* increment CDC buffer source address */
-    src_index = (src_index + 2) & 0x3ffe;
-
-    /* increment PCM-RAM destination address */
-    dst_index = (dst_index + 2) & 0xffe;
-  }
 }
 
@@ -38,6 +38,45 @@
 
 #include "shared.h"
 
+#ifdef USE_SCD_THREAD
+#include <pthread.h>
+#include <unistd.h>
+
+/* SUB-CPU host thread */
+static struct
+{
+  pthread_t id;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  uint8 running;              /* thread is started */
+  uint8 exit;                 /* thread exit request */
+  uint8 wait;                 /* MAIN-CPU is waiting for SUB-CPU */
+  uint8 wrapped;              /* shared memory accesses are trapped */
+  uint8 busy;                 /* SUB-CPU is running */
+  uint32 target;              /* SUB-CPU cycle target */
+  cpu_memory_map map[0x40];   /* MAIN-CPU shared memory map */
+  struct _zbank_memory_map zmap[0x40];
+} scd_thread;
+
+static void scd_thread_barrier(void)
+{
+  /* only needed when running on SUB-CPU thread */
+  if (scd_thread.running && pthread_equal(pthread_self(), scd_thread.id))
+  {
+    /* wait until MAIN-CPU is stopped at a synchronization point */
+    pthread_mutex_lock(&scd_thread.lock);
+    while (!scd_thread.wait)
+    {
+      pthread_cond_wait(&scd_thread.cond, &scd_thread.lock);
+    }
+    pthread_mutex_unlock(&scd_thread.lock);
+  }
+}
+#endif
+
+/* Last synchronized SUB-CPU line */
+static unsigned int sync_cycles;
+
 /*--------------------------------------------------------------------------*/
 /* Unused area (return open bus data, i.e prefetched instruction word)      */
 /*--------------------------------------------------------------------------*/
@@ -78,46 +117,21 @@ static void s68k_unused_16_w(unsigned int address, unsigned int data)
 /*--------------------------------------------------------------------------*/
 void prg_ram_dma_w(unsigned int words)
 {
-  uint16 data;
-
-  /* CDC buffer source address */
-  uint16 src_index = cdc.dac.w & 0x3ffe;
-  
   /* PRG-RAM destination address*/
   uint32 dst_index = (scd.regs[0x0a>>1].w << 3) & 0x7fffe;
   
   /* update DMA destination address */
   scd.regs[0x0a>>1].w += (words >> 2);
 
-  /* update DMA source address */
-  cdc.dac.w += (words << 1);
-
   /* check PRG-RAM write protected area */
-  if (dst_index < (scd.regs[0x02>>1].byte.h << 9))
+  if (dst_index >= (scd.regs[0x02>>1].byte.h << 9))
   {
-    return;
+    /* DMA transfer */
+    cdc_dma_copy(scd.prg_ram, dst_index, 0x7fffe, words, 1);
   }
 
-  /* DMA transfer */
-  while (words--)
-  {
-    /* read 16-bit word from CDC buffer */
-    data = *(uint16 *)(cdc.ram + src_index);
-
-#ifdef LSB_FIRST
-    /* source data is stored in big endian format */
-    data = ((data >> 8) | (data << 8)) & 0xffff;
-#endif
-
-    /* write 16-bit word to PRG-RAM */
-    *(uint16 *)(scd.prg_ram + dst_index) = data ;
-
-    /* increment CDC buffer source address */
-    src_index = (src_index + 2) & 0x3ffe;
-
-    /* increment PRG-RAM destination address */
-    dst_index = (dst_index + 2) & 0x7fffe;
-  }
+  /* update DMA source address */
+  cdc.dac.w += (words << 1);
 }
 
 /*--------------------------------------------------------------------------*/
@@ -221,6 +235,11 @@ static void s68k_poll_sync(reg)
   /* relative MAIN-CPU cycle counter */
   unsigned int cycles = (s68k.cycles * MCYCLES_PER_LINE) / SCYCLES_PER_LINE;
 
+#ifdef USE_SCD_THREAD
+  /* shared registers can only be modified once MAIN-CPU is synchronized */
+  scd_thread_barrier();
+#endif
+
   /* sync MAIN-CPU with SUB-CPU */
   if (!m68k.stopped && (m68k.cycles < cycles))
   {
@@ -503,6 +522,12 @@ static void scd_write_byte(unsigned int address, unsigned int data)
   error("[%d][%d]write byte CD register %X -> 0x%02x (%X)\n", v_counter, s68k.cycles, address, data, s68k.pc);
 #endif
 
+  /* RESET, Memory Mode & GFX operation registers are used by pending image lines */
+  if (gfx.pending && (((address & 0x1ff) < 0x04) || (((address & 0x1ff) - 0x58) < 0x10)))
+  {
+    gfx_flush();
+  }
+
   /* Gate-Array registers */
   switch (address & 0x1ff)
   {
@@ -518,6 +543,11 @@ static void scd_write_byte(unsigned int address, unsigned int data)
       /* RESET bit cleared ? */      
       if (!(data & 0x01))
       {
+#ifdef USE_SCD_THREAD
+        /* MAIN-CPU polling state is also cleared */
+        scd_thread_barrier();
+#endif
+
         /* reset CD hardware */
         scd_reset(0);
       }
@@ -780,6 +810,12 @@ static void scd_write_word(unsigned int address, unsigned int data)
   error("[%d][%d]write word CD register %X -> 0x%04x (%X)\n", v_counter, s68k.cycles, address, data, s68k.pc);
 #endif
 
+  /* RESET, Memory Mode & GFX operation registers are used by pending image lines */
+  if (gfx.pending && (((address & 0x1ff) < 0x04) || (((address & 0x1ff) - 0x58) < 0x10)))
+  {
+    gfx_flush();
+  }
+
   /* Gate-Array registers */
   switch (address & 0x1fe)
   {
@@ -791,6 +827,11 @@ static void scd_write_word(unsigned int address, unsigned int data)
       /* RESET bit cleared ? */      
       if (!(data & 0x01))
       {
+#ifdef USE_SCD_THREAD
+        /* MAIN-CPU polling state is also cleared */
+        scd_thread_barrier();
+#endif
+
         /* reset CD hardware */
         scd_reset(0);
       }
@@ -1235,21 +1276,10 @@ void scd_reset(int hard)
   pcm_reset();
 }
 
-void scd_update(unsigned int cycles)
+static void scd_run_line(void)
 {
-  /* update CDC DMA transfer */
-  if (cdc.dma_w)
-  {
-    cdc_dma_update();
-  }
-
-  /* run both CPU in sync until end of line */
-  do
-  {
-    m68k_run(cycles);
-    s68k_run(scd.cycles + SCYCLES_PER_LINE);
-  }
-  while ((m68k.cycles < cycles) || (s68k.cycles < (scd.cycles + SCYCLES_PER_LINE)));
+  /* run SUB-CPU until end of line */
+  s68k_run(scd.cycles + SCYCLES_PER_LINE);
 
   /* increment CD hardware cycle counter */
   scd.cycles += SCYCLES_PER_LINE;
@@ -1310,6 +1340,321 @@ void scd_update(unsigned int cycles)
     /* update graphics operation if running */
     gfx_update(scd.cycles);
   }
+
+  /* update CDC DMA transfer for next line */
+  if (cdc.dma_w)
+  {
+    cdc_dma_update();
+  }
+}
+
+static void scd_catchup(unsigned int cycles)
+{
+  /* catch up with MAIN-CPU, one line at a time */
+  while ((scd.cycles + SCYCLES_PER_LINE) <= cycles)
+  {
+    scd_run_line();
+  }
+
+  /* run SUB-CPU until current MAIN-CPU cycle */
+  if (s68k.cycles < cycles)
+  {
+    s68k_run(cycles);
+  }
+}
+
+#ifdef USE_SCD_THREAD
+/*--------------------------------------------------------------------------*/
+/* SUB-CPU host thread                                                      */
+/*--------------------------------------------------------------------------*/
+
+/* MAIN-CPU accesses to PRG-RAM & Word-RAM are trapped while SUB-CPU thread */
+/* is running ahead, so that they are always seen at the same SUB-CPU cycle. */
+/* NB: instruction fetches from these areas are not trapped. */
+/* Each trapped access is a full synchronization with the SUB-CPU thread, so */
+/* games constantly accessing Word-RAM from the MAIN-CPU get little benefit. */
+static unsigned int scd_shared_read_byte(unsigned int address)
+{
+  scd_sync(m68k.cycles);
+  if (m68k.memory_map[(address>>16)&0xff].read8)
+  {
+    return m68k.memory_map[(address>>16)&0xff].read8(address);
+  }
+  return READ_BYTE(m68k.memory_map[(address>>16)&0xff].base, address & 0xffff);
+}
+
+static unsigned int scd_shared_read_word(unsigned int address)
+{
+  scd_sync(m68k.cycles);
+  if (m68k.memory_map[(address>>16)&0xff].read16)
+  {
+    return m68k.memory_map[(address>>16)&0xff].read16(address);
+  }
+  return *(uint16 *)(m68k.memory_map[(address>>16)&0xff].base + (address & 0xffff));
+}
+
+static void scd_shared_write_byte(unsigned int address, unsigned int data)
+{
+  scd_sync(m68k.cycles);
+  if (m68k.memory_map[(address>>16)&0xff].write8)
+  {
+    m68k.memory_map[(address>>16)&0xff].write8(address, data);
+    return;
+  }
+  WRITE_BYTE(m68k.memory_map[(address>>16)&0xff].base, address & 0xffff, data);
+}
+
+static void scd_shared_write_word(unsigned int address, unsigned int data)
+{
+  scd_sync(m68k.cycles);
+  if (m68k.memory_map[(address>>16)&0xff].write16)
+  {
+    m68k.memory_map[(address>>16)&0xff].write16(address, data);
+    return;
+  }
+  *(uint16 *)(m68k.memory_map[(address>>16)&0xff].base + (address & 0xffff)) = data;
+}
+
+static unsigned int scd_shared_zbank_read(unsigned int address)
+{
+  scd_sync(m68k.cycles);
+  if (zbank_memory_map[(address>>16)&0xff].read)
+  {
+    return zbank_memory_map[(address>>16)&0xff].read(address);
+  }
+  return READ_BYTE(m68k.memory_map[(address>>16)&0xff].base, address & 0xffff);
+}
+
+static void scd_shared_zbank_write(unsigned int address, unsigned int data)
+{
+  scd_sync(m68k.cycles);
+  if (zbank_memory_map[(address>>16)&0xff].write)
+  {
+    zbank_memory_map[(address>>16)&0xff].write(address, data);
+    return;
+  }
+  WRITE_BYTE(m68k.memory_map[(address>>16)&0xff].base, address & 0xffff, data);
+}
+
+static void scd_thread_wrap(void)
+{
+  int i, slot;
+
+  /* $000000-$3FFFFF (resp. $400000-$7FFFFF): CD memory area */
+  for (i=0; i<0x40; i++)
+  {
+    /* BOOT ROM is not shared */
+    if ((i < 0x20) && !(i & 2)) continue;
+
+    slot = scd.cartridge.boot + i;
+    scd_thread.map[i] = m68k.memory_map[slot];
+    scd_thread.zmap[i] = zbank_memory_map[slot];
+    m68k.memory_map[slot].read8   = scd_shared_read_byte;
+    m68k.memory_map[slot].read16  = scd_shared_read_word;
+    m68k.memory_map[slot].write8  = scd_shared_write_byte;
+    m68k.memory_map[slot].write16 = scd_shared_write_word;
+    zbank_memory_map[slot].read   = scd_shared_zbank_read;
+    zbank_memory_map[slot].write  = scd_shared_zbank_write;
+  }
+
+  scd_thread.wrapped = 1;
+}
+
+static void scd_thread_unwrap(void)
+{
+  int i, slot;
+
+  for (i=0; i<0x40; i++)
+  {
+    if ((i < 0x20) && !(i & 2)) continue;
+
+    slot = scd.cartridge.boot + i;
+    m68k.memory_map[slot] = scd_thread.map[i];
+    zbank_memory_map[slot] = scd_thread.zmap[i];
+  }
+
+  scd_thread.wrapped = 0;
+}
+
+static void *scd_thread_run(void *arg)
+{
+  unsigned int cycles;
+
+  pthread_mutex_lock(&scd_thread.lock);
+
+  for (;;)
+  {
+    if (scd_thread.busy)
+    {
+      /* run SUB-CPU until requested cycle (target can be increased meanwhile) */
+      cycles = scd_thread.target;
+      pthread_mutex_unlock(&scd_thread.lock);
+      scd_catchup(cycles);
+      pthread_mutex_lock(&scd_thread.lock);
+      if (scd_thread.target == cycles)
+      {
+        scd_thread.busy = 0;
+        pthread_cond_broadcast(&scd_thread.cond);
+      }
+    }
+    else if (scd_thread.exit)
+    {
+      break;
+    }
+    else
+    {
+      pthread_cond_wait(&scd_thread.cond, &scd_thread.lock);
+    }
+  }
+
+  pthread_mutex_unlock(&scd_thread.lock);
+  return NULL;
+}
+
+static void scd_thread_post(unsigned int cycles)
+{
+  /* NB: called with lock held */
+  if (scd_thread.busy)
+  {
+    /* extend current SUB-CPU execution */
+    if (scd_thread.target < cycles)
+    {
+      scd_thread.target = cycles;
+    }
+  }
+
+  /* SUB-CPU state can safely be checked when thread is idle (MAIN-CPU might also have restarted it from an earlier cycle) */
+  else if (((scd.cycles + SCYCLES_PER_LINE) <= cycles) || (s68k.cycles < cycles))
+  {
+    scd_thread.target = cycles;
+    scd_thread.busy = 1;
+    pthread_cond_broadcast(&scd_thread.cond);
+  }
+}
+
+static void scd_thread_start(void)
+{
+  pthread_mutex_init(&scd_thread.lock, NULL);
+  pthread_cond_init(&scd_thread.cond, NULL);
+  scd_thread.exit = 0;
+  scd_thread.wait = 0;
+  scd_thread.busy = 0;
+  scd_thread.target = 0;
+
+  /* slower than sequential execution without a second host CPU */
+  if ((sysconf(_SC_NPROCESSORS_ONLN) < 2) || pthread_create(&scd_thread.id, NULL, scd_thread_run, NULL))
+  {
+    /* fall back to single thread */
+    pthread_cond_destroy(&scd_thread.cond);
+    pthread_mutex_destroy(&scd_thread.lock);
+    config.scd_thread = 0;
+    return;
+  }
+
+  scd_thread.running = 1;
+}
+
+void scd_thread_stop(void)
+{
+  if (!scd_thread.running) return;
+
+  if (scd_thread.wrapped)
+  {
+    scd_thread_unwrap();
+  }
+
+  /* let SUB-CPU complete current execution then exit */
+  pthread_mutex_lock(&scd_thread.lock);
+  scd_thread.wait = 1;
+  scd_thread.exit = 1;
+  pthread_cond_broadcast(&scd_thread.cond);
+  pthread_mutex_unlock(&scd_thread.lock);
+  pthread_join(scd_thread.id, NULL);
+
+  pthread_cond_destroy(&scd_thread.cond);
+  pthread_mutex_destroy(&scd_thread.lock);
+  scd_thread.running = 0;
+}
+#endif
+
+void scd_sync(unsigned int cycles)
+{
+  /* relative SUB-CPU cycle counter */
+  cycles = (cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE;
+
+  /* last synchronized SUB-CPU line */
+  if (sync_cycles < (cycles - (cycles % SCYCLES_PER_LINE)))
+  {
+    sync_cycles = cycles - (cycles % SCYCLES_PER_LINE);
+  }
+
+#ifdef USE_SCD_THREAD
+  if (scd_thread.running && !pthread_equal(pthread_self(), scd_thread.id))
+  {
+    /* MAIN-CPU shared memory accesses no longer need to be trapped */
+    if (scd_thread.wrapped)
+    {
+      scd_thread_unwrap();
+    }
+
+    /* wait for SUB-CPU thread to reach current MAIN-CPU cycle */
+    pthread_mutex_lock(&scd_thread.lock);
+    scd_thread_post(cycles);
+    scd_thread.wait = 1;
+    pthread_cond_broadcast(&scd_thread.cond);
+    while (scd_thread.busy)
+    {
+      pthread_cond_wait(&scd_thread.cond, &scd_thread.lock);
+    }
+    scd_thread.wait = 0;
+    pthread_mutex_unlock(&scd_thread.lock);
+    return;
+  }
+#endif
+
+  scd_catchup(cycles);
+}
+
+void scd_update(unsigned int cycles)
+{
+  do
+  {
+    /* run MAIN-CPU until end of line */
+    m68k_run(cycles);
+
+    /* SUB-CPU is only synchronized when MAIN-CPU is stopped (waiting for SUB-CPU) or when it is running too late */
+    if (m68k.stopped || ((cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE >= (sync_cycles + (SCYCLES_PER_LINE * SCD_SYNC_LINES))))
+    {
+      scd_sync(cycles);
+    }
+  }
+  while (m68k.cycles < cycles);
+
+#ifdef USE_SCD_THREAD
+  if (config.scd_thread)
+  {
+    if (!scd_thread.running)
+    {
+      scd_thread_start();
+      if (!scd_thread.running) return;
+    }
+
+    /* trap MAIN-CPU shared memory accesses while SUB-CPU is running ahead */
+    if (!scd_thread.wrapped)
+    {
+      scd_thread_wrap();
+    }
+
+    /* let SUB-CPU thread run until end of line */
+    pthread_mutex_lock(&scd_thread.lock);
+    scd_thread_post((cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE);
+    pthread_mutex_unlock(&scd_thread.lock);
+  }
+  else if (scd_thread.running)
+  {
+    scd_thread_stop();
+  }
+#endif
 }
 
 void scd_end_frame(unsigned int cycles)
@@ -1324,6 +1669,7 @@ void scd_end_frame(unsigned int cycles)
   /* adjust SUB-CPU & GPU cycle counters for next frame */
   s68k.cycles -= cycles;
   gfx.cycles  -= cycles;
+  sync_cycles = 0;
 
   /* reset CPU registers polling */
   m68k.poll.cycle = 0;
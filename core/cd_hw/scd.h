@@ -56,6 +56,10 @@
 /* Timer & Stopwatch clocks divider */
 #define TIMERS_SCYCLES_RATIO (384 * 4)
 
+/* Max. number of lines SUB-CPU can run behind MAIN-CPU before being synchronized */
+/* SUB-CPU is otherwise only synchronized when MAIN-CPU accesses shared registers */
+#define SCD_SYNC_LINES 16
+
 /* CD hardware */
 typedef struct 
 {
@@ -81,6 +85,10 @@ typedef struct
 extern void scd_init(void);
 extern void scd_reset(int hard);
 extern void scd_update(unsigned int cycles);
+extern void scd_sync(unsigned int cycles);
+#ifdef USE_SCD_THREAD
+extern void scd_thread_stop(void);
+#endif
 extern void scd_end_frame(unsigned int cycles);
 extern int scd_context_load(uint8 *state);
 extern int scd_context_save(uint8 *state);
@@ -41,12 +41,17 @@
 
 #include "shared.h"
 
+#ifdef USE_ROM_CACHE
+external_t ext __attribute__((aligned(0x10000))); /* External Hardware (cartridge ROM is page-aligned to be memory-mapped) */
+#else
 external_t ext;           /* External Hardware (Cartridge, CD unit, ...) */
+#endif
 uint8 boot_rom[0x800];    /* Genesis BOOT ROM   */
 uint8 work_ram[0x10000];  /* 68K RAM  */
 uint8 zram[0x2000];       /* Z80 RAM  */
 uint32 zbank;             /* Z80 bank window address */
 uint8 zstate;             /* Z80 bus state (d0 = BUSACK, d1 = /RESET) */
+uint8 zsync;              /* Z80 lock-step frame counter (0 = Z80 only run on demand) */
 uint8 pico_current;       /* PICO current page */
 
 static uint8 tmss[4];     /* TMSS security register */
@@ -274,6 +279,9 @@ void gen_reset(int hard_reset)
     m68k.memory_map[0xa0].write16 = m68k_unused_16_w;
     zstate = 0;
 
+    /* Z80 runs in lock-step with 68k until it proves not to access shared hardware */
+    zsync = ZSYNC_FRAMES;
+
     /* assume default bank is $000000-$007FFF */
     zbank = 0;  
 
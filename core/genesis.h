@@ -46,6 +46,9 @@
 #include "sms_cart.h"
 #include "scd.h"
 
+/* Number of frames the Z80 is kept in lock-step with 68k after accessing shared hardware */
+#define ZSYNC_FRAMES 60
+
 /* External Hardware */
 typedef union
 {
@@ -60,6 +63,7 @@ extern uint8 work_ram[0x10000];
 extern uint8 zram[0x2000];
 extern uint32 zbank;
 extern uint8 zstate;
+extern uint8 zsync;
 extern uint8 pico_current;
 
 /* Function prototypes */
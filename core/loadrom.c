@@ -40,6 +40,14 @@
 #include <ctype.h>
 #include "shared.h"
 
+#ifdef USE_ROM_CACHE
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#endif
+
 /*** ROM Information ***/
 #define ROMCONSOLE    256
 #define ROMCOPYRIGHT  272
@@ -228,6 +236,129 @@ static void deinterleave_block(uint8 * src)
   }
 }
 
+#ifdef USE_ROM_CACHE
+/***************************************************************************
+ * ROM image cache
+ *
+ * Once byteswapped (or deinterleaved), cartridge ROM is mapped from a cache
+ * file with identical contents over the cartridge ROM buffer. The cache file
+ * is named after ROM CRC and size, created once and only ever replaced by an
+ * atomic rename, so mapped pages never change underneath a running game (the
+ * user's ROM file is never mapped, as it could be rewritten or truncated).
+ * All instances running the same game share these pages through the system
+ * page cache instead of each keeping a private copy. The mapping is private,
+ * so patches (Game Genie, Action Replay, ...) are still local to one instance.
+ * One file is kept per game, so the cache is only used when enabled by the
+ * frontend (config.rom_cache).
+ ***************************************************************************/
+static uint8 *rom_cache_base;
+static size_t rom_cache_size;
+
+static void rom_cache_release(void)
+{
+  if (rom_cache_size)
+  {
+    /* restore anonymous memory */
+    mmap(rom_cache_base, rom_cache_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0);
+    rom_cache_size = 0;
+  }
+}
+
+static int rom_cache_open(const char *filename, size_t size)
+{
+  struct stat st;
+  void *ptr;
+  int fd = open(filename, O_RDONLY);
+  if (fd < 0)
+  {
+    return 0;
+  }
+
+  /* file should have the exact ROM size */
+  if (fstat(fd, &st) || (st.st_size != cart.romsize))
+  {
+    close(fd);
+    return 0;
+  }
+
+  /* file contents should match ROM buffer */
+  ptr = mmap(NULL, size, PROT_READ, MAP_SHARED, fd, 0);
+  if (ptr == MAP_FAILED)
+  {
+    close(fd);
+    return 0;
+  }
+  if (memcmp(ptr, cart.rom, size))
+  {
+    munmap(ptr, size);
+    close(fd);
+    return 0;
+  }
+  munmap(ptr, size);
+
+  /* map file over the page-aligned part of ROM buffer */
+  ptr = mmap(cart.rom, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0);
+  close(fd);
+  if (ptr == MAP_FAILED)
+  {
+    return 0;
+  }
+
+  rom_cache_base = ptr;
+  rom_cache_size = size;
+  return 1;
+}
+
+static void rom_cache_map(void)
+{
+  char filename[MAXPATHLEN];
+  char tmpname[MAXPATHLEN + 16];
+  size_t page = sysconf(_SC_PAGESIZE);
+  size_t size = cart.romsize & ~(page - 1);
+  uint32 crc;
+  int fd;
+
+  /* ROM buffer should be page-aligned (see genesis.c) and ROM should fill at least one page */
+  if (((size_t)cart.rom & (page - 1)) || !size)
+  {
+    return;
+  }
+
+  crc = crc32(0, cart.rom, cart.romsize);
+  snprintf(filename, sizeof(filename), "%s/%08x_%x.rom", ROM_CACHE_PATH, crc, cart.romsize);
+
+  /* check if ROM image has already been saved */
+  if (rom_cache_open(filename, size))
+  {
+    return;
+  }
+
+  /* save ROM image to a temporary file then rename it, so that other instances never see an incomplete file */
+  snprintf(tmpname, sizeof(tmpname), "%s.%d", filename, (int)getpid());
+  fd = open(tmpname, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0)
+  {
+    return;
+  }
+
+  if (write(fd, cart.rom, cart.romsize) != (ssize_t)cart.romsize)
+  {
+    close(fd);
+    unlink(tmpname);
+    return;
+  }
+  close(fd);
+
+  if (rename(tmpname, filename))
+  {
+    unlink(tmpname);
+    return;
+  }
+
+  rom_cache_open(filename, size);
+}
+#endif
+
 /***************************************************************************
  *
  * Pass a pointer to the ROM base address.
@@ -533,6 +664,11 @@ int load_rom(char *filename)
   ggenie_shutdown();
   areplay_shutdown();
 
+#ifdef USE_ROM_CACHE
+  /* unmap previously cached ROM image */
+  rom_cache_release();
+#endif
+
   /* check previous loaded ROM size */
   if (cart.romsize > 0x800000)
   {
@@ -682,6 +818,14 @@ int load_rom(char *filename)
   }
 #endif
 
+#ifdef USE_ROM_CACHE
+  /* share ROM image with other instances */
+  if ((system_hw != SYSTEM_MCD) && config.rom_cache)
+  {
+    rom_cache_map();
+  }
+#endif
+
   /* Save auto-detected system hardware  */
   romtype = system_hw;
 
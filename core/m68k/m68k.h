@@ -227,12 +227,19 @@ typedef struct
   uint detected;
 } cpu_idle_t;
 
+/* 68k idle loop skipping */
+typedef struct
+{
+  uint pc;              /* loop branch instruction address */
+  uint cycle;           /* cycle count at previous loop iteration */
+  uint detected;        /* 0: not an idle loop, 1: idle loop candidate, 2: previous iteration state saved */
+  uint dar[16];         /* Data and Address Registers at previous loop iteration */
+  uint flags[5];        /* Condition Codes at previous loop iteration */
+} cpu_loop_t;
+
+/* CPU state (most often accessed fields are kept first, in the same cache lines) */
 typedef struct
 {
-  cpu_memory_map memory_map[256]; /* memory mapping */
-
-  cpu_idle_t poll;      /* polling detection */
-
   uint cycles;          /* current master cycle count */ 
   uint cycle_end;       /* aimed master cycle count for current execution frame */
 
@@ -251,6 +258,11 @@ typedef struct
   uint int_level;       /* State of interrupt pins IPL0-IPL2 -- ASG: changed from ints_pending */
   uint stopped;         /* Stopped state */
 
+  cpu_memory_map memory_map[256]; /* memory mapping */
+
+  cpu_idle_t poll;      /* polling detection */
+  cpu_loop_t loop;      /* idle loop detection */
+
   uint pref_addr;       /* Last prefetch address */
   uint pref_data;       /* Data in the prefetch queue */
 
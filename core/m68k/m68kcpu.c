@@ -3,6 +3,7 @@
 /* ======================================================================== */
 
 extern int vdp_68k_irq_ack(int int_level);
+extern unsigned int vdp_read_idle(unsigned int address, unsigned int cycles);
 
 #define m68ki_cpu m68k
 #define MUL (7)
@@ -12,7 +13,7 @@ extern int vdp_68k_irq_ack(int int_level);
 /* ======================================================================== */
 
 #ifndef BUILD_TABLES
-#include "m68ki_cycles.h"
+#include "m68ki_opcode_table.h"
 #endif
 
 #include "m68kconf.h"
@@ -23,10 +24,6 @@ extern int vdp_68k_irq_ack(int int_level);
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-#ifdef BUILD_TABLES
-static unsigned char m68ki_cycles[0x10000];
-#endif
-
 static int irq_latency;
 
 m68ki_cpu_core m68k;
@@ -228,17 +225,23 @@ void m68k_set_irq_delay(unsigned int int_level)
     /* the middle of its execution (first memory write).                   */
     if ((REG_IR & 0xF000) != 0x2000)
     {
+      uint ir = REG_IR;
+
       /* Finish executing current instruction */
-      USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+      USE_CYCLES(CYC_INSTRUCTION(ir));
 
       /* One instruction delay before interrupt */
       irq_latency = 1;
       m68ki_trace_t1() /* auto-disable (see m68kcpu.h) */
       m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
       REG_IR = m68ki_read_imm_16();
-      m68ki_instruction_jump_table[REG_IR]();
+      m68ki_instruction_handler(REG_IR)();
       m68ki_exception_if_trace() /* auto-disable (see m68kcpu.h) */
       irq_latency = 0;
+
+      /* Current instruction cycles are counted again on return */
+      USE_CYCLES(CYC_INSTRUCTION(REG_IR) - CYC_INSTRUCTION(ir));
+      REG_IR = ir;
     }
 
     /* Set IRQ level */
@@ -253,6 +256,7 @@ void m68k_set_irq_delay(unsigned int int_level)
   m68ki_check_interrupts(); /* Level triggered (IRQ) */
 }
 
+
 void m68k_run(unsigned int cycles) 
 {
   /* Make sure CPU is not already ahead */
@@ -274,6 +278,14 @@ void m68k_run(unsigned int cycles)
   /* Save end cycles count for when CPU is stopped */
   m68k.cycle_end = cycles;
 
+#if M68K_IDLE_LOOP_SKIP
+  /* Restart idle loop detection (memory might have been modified since last execution frame) */
+  if (m68k.loop.detected)
+  {
+    m68k.loop.detected = 1;
+  }
+#endif
+
   /* Return point for when we have an address error (TODO: use goto) */
   m68ki_set_address_error_trap() /* auto-disable (see m68kcpu.h) */
 
@@ -289,12 +301,17 @@ void m68k_run(unsigned int cycles)
     /* Set the address space for reads */
     m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
 
+#if M68K_INSTRUCTION_CACHE
+    /* Execute predecoded instructions */
+    m68ki_cache_execute(cycles);
+#else
     /* Decode next instruction */
     REG_IR = m68ki_read_imm_16();
 	
     /* Execute instruction */
-	m68ki_instruction_jump_table[REG_IR]();
-    USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+	m68ki_instruction_handler(REG_IR)();
+    USE_CYCLES(CYC_INSTRUCTION(REG_IR));
+#endif
 
     /* Trace m68k_exception, if necessary */
     m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
@@ -214,7 +214,23 @@
 #define CPU_RUN_MODE     m68ki_cpu.run_mode
 #endif
 
-#define CYC_INSTRUCTION   m68ki_cycles
+#ifdef BUILD_TABLES
+/* Opcode tables are built at startup (see m68kops.h) */
+static unsigned char m68ki_cycles[0x10000];
+static void (*m68ki_instruction_jump_table[0x10000])(void);
+#define CYC_INSTRUCTION(A) m68ki_cycles[A]
+#define m68ki_instruction_handler(A) m68ki_instruction_jump_table[A]
+#else
+/* Opcode tables are shared by main & sub CPU cores (see m68ki_opcode_table.h) */
+extern const unsigned short m68ki_opcode_page[0x1000];
+extern const unsigned short m68ki_opcode_handler[];
+extern const unsigned char m68ki_opcode_cycles[];
+/* Opcode handlers are defined by each CPU core (see m68ki_instruction_jump_table.h) */
+static void (* const m68ki_instruction_handler_table[1701])(void);
+#define M68KI_OPCODE_INDEX(A) (m68ki_opcode_page[(A) >> 4] + ((A) & 0x0f))
+#define CYC_INSTRUCTION(A) (m68ki_opcode_cycles[M68KI_OPCODE_INDEX(A)] * MUL)
+#define m68ki_instruction_handler(A) m68ki_instruction_handler_table[m68ki_opcode_handler[M68KI_OPCODE_INDEX(A)]]
+#endif
 #define CYC_EXCEPTION     m68ki_exception_cycle_table
 #define CYC_BCC_NOTAKE_B  ( -2 * MUL)
 #define CYC_BCC_NOTAKE_W  (  2 * MUL)
@@ -408,7 +424,14 @@
 
 /* --------------------------- Status Register ---------------------------- */
 
-/* Flag Calculation Macros */
+/* Flag Calculation Macros
+ *
+ * Condition codes are already evaluated lazily: instead of booleans, flags
+ * hold raw (shifted) result words and only the relevant bit is tested when
+ * flags are actually read (see COND_xx and m68ki_get_sr). Most handlers thus
+ * only store their result once per flag, with the exception of V and 32-bit
+ * C which require combining operands.
+ */
 #define CFLAG_8(A) (A)
 #define CFLAG_16(A) ((A)>>8)
 
@@ -761,6 +784,41 @@ INLINE void m68ki_branch_8(uint offset);
 INLINE void m68ki_branch_16(uint offset);
 INLINE void m68ki_branch_32(uint offset);
 
+#if M68K_IDLE_LOOP_SKIP
+/* Maximal idle loop size (in bytes) */
+#define M68K_IDLE_LOOP_SIZE 32
+
+/* Idle loop detection */
+INLINE int m68ki_idle_loop_read(uint address, uint size, uint *limit);
+INLINE int m68ki_idle_loop_ea(uint ea, uint size, uint pc, uint *limit);
+static uint m68ki_idle_loop_check(uint pc, uint end, uint *limit);
+static void m68ki_idle_loop_detect(uint branch);
+#endif
+
+#if M68K_INSTRUCTION_CACHE
+/* Predecoded instruction traces */
+#define M68K_CACHE_TRACES 1024
+#define M68K_CACHE_LENGTH 16
+
+typedef struct
+{
+  uint pc;                /* instruction address */
+  uint16 ir;              /* instruction word */
+  uint16 cycles;          /* instruction base cycles */
+  void (*handler)(void);  /* instruction handler */
+} m68ki_cache_entry;
+
+typedef struct
+{
+  uint count;             /* number of recorded instructions */
+  m68ki_cache_entry entry[M68K_CACHE_LENGTH];
+} m68ki_cache_trace;
+
+static m68ki_cache_trace m68ki_cache[M68K_CACHE_TRACES];
+
+static void m68ki_cache_execute(uint cycles);
+#endif
+
 /* Status register operations. */
 INLINE void m68ki_set_s_flag(uint value);            /* Only bit 2 of value should be set (i.e. 4 or 0) */
 INLINE void m68ki_set_ccr(uint value);               /* set the condition code register */
@@ -1129,6 +1187,14 @@ INLINE void m68ki_jump_vector(uint vector)
 INLINE void m68ki_branch_8(uint offset)
 {
   REG_PC += MAKE_INT_8(offset);
+
+#if M68K_IDLE_LOOP_SKIP
+  /* short backward branch: check for idle loop */
+  if ((offset >= (0x100 - M68K_IDLE_LOOP_SIZE)) && (offset < 0xff))
+  {
+    m68ki_idle_loop_detect(REG_PC - MAKE_INT_8(offset) - 2);
+  }
+#endif
 }
 
 INLINE void m68ki_branch_16(uint offset)
@@ -1142,6 +1208,337 @@ INLINE void m68ki_branch_32(uint offset)
 }
 
 
+#if M68K_IDLE_LOOP_SKIP
+/* Idle loop detection.
+ * A loop is considered idle when its body only reads memory and modifies data
+ * registers or condition codes, and when the CPU state at the end of one
+ * iteration is identical to the one at the end of the previous iteration.
+ * Since interrupts and other hardware events are only processed between two
+ * execution frames, following iterations would then produce the exact same
+ * result until the end of current execution frame, or until memory read by
+ * the loop is modified by hardware.
+ * Loop body cannot contain any branch so that iteration duration can be used
+ * to verify that no other instructions were executed since previous iteration.
+ */
+
+/* Check memory read by loop body, limit is set to the cycle count until which
+ * read data is stable (NULL when only checking loop instructions).
+ */
+INLINE int m68ki_idle_loop_read(uint address, uint size, uint *limit)
+{
+  cpu_memory_map *temp;
+
+  if (size > 1)
+  {
+    /* word & long reads from odd address generate address error exception */
+    if (address & 1)
+    {
+      return 0;
+    }
+
+    /* long reads are done with two word reads */
+    if (size == 4)
+    {
+      if (!m68ki_idle_loop_read(address + 2, 2, limit))
+      {
+        return 0;
+      }
+    }
+  }
+
+  if (limit)
+  {
+    temp = &m68ki_cpu.memory_map[((address)>>16)&0xff];
+
+    if ((size == 1) ? temp->read8 : temp->read16)
+    {
+#if M68K_IDLE_LOOP_SKIP == OPT_SPECIFY_HANDLER
+      /* I/O read handler */
+      uint cycle = M68K_IDLE_LOOP_CALLBACK(ADDRESS_68K(address), m68ki_cpu.loop.cycle);
+      if (cycle < *limit)
+      {
+        *limit = cycle;
+      }
+      return (cycle != 0);
+#else
+      return 0;
+#endif
+    }
+  }
+
+  return 1;
+}
+
+/* Check effective address used by loop instruction (returns extension words size or -1 if not allowed) */
+INLINE int m68ki_idle_loop_ea(uint ea, uint size, uint pc, uint *limit)
+{
+  uint address;
+  int ext;
+
+  switch (ea >> 3)
+  {
+    case 0: /* Dn */
+    {
+      return 0;
+    }
+
+    case 1: /* An */
+    {
+      return (size > 1) ? 0 : -1;
+    }
+
+    case 2: /* (An) */
+    {
+      address = REG_A[ea & 7];
+      ext = 0;
+      break;
+    }
+
+    case 5: /* (d16,An) */
+    {
+      address = REG_A[ea & 7] + MAKE_INT_16(m68k_read_immediate_16(pc));
+      ext = 2;
+      break;
+    }
+
+    case 7:
+    {
+      switch (ea & 7)
+      {
+        case 0: /* (xxx).W */
+        {
+          address = MAKE_INT_16(m68k_read_immediate_16(pc));
+          ext = 2;
+          break;
+        }
+
+        case 1: /* (xxx).L */
+        {
+          address = m68k_read_immediate_32(pc);
+          ext = 4;
+          break;
+        }
+
+        case 2: /* (d16,PC) */
+        {
+          address = pc + MAKE_INT_16(m68k_read_immediate_16(pc));
+          ext = 2;
+          break;
+        }
+
+        case 4: /* #<data> */
+        {
+          return (size == 4) ? 4 : 2;
+        }
+
+        default: /* indexed modes */
+        {
+          return -1;
+        }
+      }
+      break;
+    }
+
+    default: /* (An)+, -(An) & indexed modes modify or depend on loop state */
+    {
+      return -1;
+    }
+  }
+
+  return m68ki_idle_loop_read(address, size, limit) ? ext : -1;
+}
+
+/* Check loop body instructions and return loop iteration duration (0 if not allowed) */
+/* NB: address registers are never modified so effective addresses remain the same */
+static uint m68ki_idle_loop_check(uint pc, uint end, uint *limit)
+{
+  uint cycles = 0;
+
+  while (pc < end)
+  {
+    uint ir = m68k_read_immediate_16(pc);
+    uint size = 1 << ((ir >> 6) & 3);
+    int ext;
+
+    pc += 2;
+
+    switch (ir >> 12)
+    {
+      case 0x0:
+      {
+        if ((ir & 0xffc0) == 0x0800) /* BTST #<data>,<ea> */
+        {
+          ext = m68ki_idle_loop_ea(ir & 0x3f, (ir & 0x38) ? 1 : 4, pc + 2, limit);
+          ext = (ext < 0) ? ext : (ext + 2);
+        }
+        else if ((ir & 0xf1c0) == 0x0100) /* BTST Dn,<ea> */
+        {
+          ext = m68ki_idle_loop_ea(ir & 0x3f, (ir & 0x38) ? 1 : 4, pc, limit);
+        }
+        else if (size > 4)
+        {
+          return 0;
+        }
+        else if ((ir & 0xff00) == 0x0c00) /* CMPI #<data>,<ea> */
+        {
+          uint imm = (size == 4) ? 4 : 2;
+          ext = m68ki_idle_loop_ea(ir & 0x3f, size, pc + imm, limit);
+          ext = (ext < 0) ? ext : (ext + imm);
+        }
+        else if ((((ir & 0xff00) == 0x0000) || ((ir & 0xff00) == 0x0200) || ((ir & 0xff00) == 0x0a00)) && !(ir & 0x38)) /* ORI/ANDI/EORI #<data>,Dn */
+        {
+          ext = (size == 4) ? 4 : 2;
+        }
+        else
+        {
+          return 0;
+        }
+        break;
+      }
+
+      case 0x1: /* MOVE.B <ea>,Dn */
+      case 0x2: /* MOVE.L <ea>,Dn */
+      case 0x3: /* MOVE.W <ea>,Dn */
+      {
+        if (ir & 0x1c0)
+        {
+          return 0;
+        }
+        ext = m68ki_idle_loop_ea(ir & 0x3f, (ir & 0x1000) ? ((ir & 0x2000) ? 2 : 1) : 4, pc, limit);
+        break;
+      }
+
+      case 0x4:
+      {
+        if (((ir & 0xff00) == 0x4a00) && (size <= 4)) /* TST <ea> */
+        {
+          ext = m68ki_idle_loop_ea(ir & 0x3f, size, pc, limit);
+        }
+        else if (ir == 0x4e71) /* NOP */
+        {
+          ext = 0;
+        }
+        else
+        {
+          return 0;
+        }
+        break;
+      }
+
+      case 0x7: /* MOVEQ */
+      {
+        if (ir & 0x100)
+        {
+          return 0;
+        }
+        ext = 0;
+        break;
+      }
+
+      case 0x8: /* OR <ea>,Dn */
+      case 0xc: /* AND <ea>,Dn */
+      {
+        if ((ir & 0x100) || (size > 4))
+        {
+          return 0;
+        }
+        ext = m68ki_idle_loop_ea(ir & 0x3f, size, pc, limit);
+        break;
+      }
+
+      case 0xb: /* CMP <ea>,Dn & CMPA <ea>,An */
+      {
+        if (size > 4)
+        {
+          size = (ir & 0x100) ? 4 : 2;
+        }
+        else if (ir & 0x100)
+        {
+          return 0;
+        }
+        ext = m68ki_idle_loop_ea(ir & 0x3f, size, pc, limit);
+        break;
+      }
+
+      default:
+      {
+        return 0;
+      }
+    }
+
+    if (ext < 0)
+    {
+      return 0;
+    }
+
+    pc += ext;
+    cycles += CYC_INSTRUCTION(ir);
+  }
+
+  /* add loop branch instruction */
+  return (pc == end) ? (cycles + CYC_INSTRUCTION(m68k_read_immediate_16(end))) : 0;
+}
+
+static void m68ki_idle_loop_detect(uint branch)
+{
+  cpu_loop_t *loop = &m68ki_cpu.loop;
+  uint i;
+
+  if (loop->pc != branch)
+  {
+    /* new loop: check loop instructions (BSR is not allowed) */
+    loop->pc = branch;
+    loop->detected = ((REG_IR & 0xff00) != 0x6100) && m68ki_idle_loop_check(REG_PC, branch, NULL);
+  }
+  else if (loop->detected == 2)
+  {
+    /* compare CPU state with previous loop iteration */
+    for (i=0; i<16; i++)
+    {
+      if (REG_DA[i] != loop->dar[i]) break;
+    }
+
+    if ((i == 16) && (FLAG_X == loop->flags[0]) && (FLAG_N == loop->flags[1]) && (FLAG_Z == loop->flags[2]) && (FLAG_V == loop->flags[3]) && (FLAG_C == loop->flags[4]))
+    {
+      /* loop iteration duration */
+      uint cycles = m68ki_cpu.cycles - loop->cycle;
+
+      /* check loop was not exited since previous iteration and memory read by loop body is stable until the end of execution frame */
+      uint limit = m68ki_cpu.cycle_end;
+      if ((m68ki_idle_loop_check(REG_PC, branch, &limit) == cycles) && (limit > m68ki_cpu.cycles))
+      {
+        /* skip loop iterations (last ones are executed normally to stop at the exact same cycle) */
+        i = (limit - m68ki_cpu.cycles) / cycles;
+        if (i > 1)
+        {
+          USE_CYCLES((i - 1) * cycles);
+        }
+      }
+
+      loop->cycle = m68ki_cpu.cycles;
+      return;
+    }
+  }
+
+  if (loop->detected)
+  {
+    /* save CPU state */
+    for (i=0; i<16; i++)
+    {
+      loop->dar[i] = REG_DA[i];
+    }
+    loop->flags[0] = FLAG_X;
+    loop->flags[1] = FLAG_N;
+    loop->flags[2] = FLAG_Z;
+    loop->flags[3] = FLAG_V;
+    loop->flags[4] = FLAG_C;
+    loop->cycle = m68ki_cpu.cycles;
+    loop->detected = 2;
+  }
+}
+#endif
+
+
 
 /* ---------------------------- Status Register --------------------------- */
 
@@ -1286,7 +1683,7 @@ static void m68ki_exception_privilege_violation(void)
   m68ki_jump_vector(EXCEPTION_PRIVILEGE_VIOLATION);
 
   /* Use up some clock cycles and undo the instruction's cycles */
-  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_PRIVILEGE_VIOLATION] - CYC_INSTRUCTION[REG_IR]);
+  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_PRIVILEGE_VIOLATION] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for A-Line instructions */
@@ -1297,7 +1694,7 @@ INLINE void m68ki_exception_1010(void)
   m68ki_jump_vector(EXCEPTION_1010);
 
   /* Use up some clock cycles and undo the instruction's cycles */
-  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1010] - CYC_INSTRUCTION[REG_IR]);
+  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1010] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for F-Line instructions */
@@ -1308,7 +1705,7 @@ INLINE void m68ki_exception_1111(void)
   m68ki_jump_vector(EXCEPTION_1111);
 
   /* Use up some clock cycles and undo the instruction's cycles */
-  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1111] - CYC_INSTRUCTION[REG_IR]);
+  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_1111] - CYC_INSTRUCTION(REG_IR));
 }
 
 /* Exception for illegal instructions */
@@ -1324,7 +1721,7 @@ INLINE void m68ki_exception_illegal(void)
   m68ki_jump_vector(EXCEPTION_ILLEGAL_INSTRUCTION);
 
   /* Use up some clock cycles and undo the instruction's cycles */
-  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ILLEGAL_INSTRUCTION] - CYC_INSTRUCTION[REG_IR]);
+  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ILLEGAL_INSTRUCTION] - CYC_INSTRUCTION(REG_IR));
 }
 
 
@@ -1341,7 +1738,7 @@ INLINE void m68ki_exception_address_error(void)
   if(CPU_RUN_MODE == RUN_MODE_BERR_AERR_RESET)
   {
     CPU_STOPPED = STOP_LEVEL_HALT;
-    SET_CYCLES(m68ki_cpu.cycle_end - CYC_INSTRUCTION[REG_IR]);
+    SET_CYCLES(m68ki_cpu.cycle_end - CYC_INSTRUCTION(REG_IR));
     return;
   }
   CPU_RUN_MODE = RUN_MODE_BERR_AERR_RESET;
@@ -1352,7 +1749,7 @@ INLINE void m68ki_exception_address_error(void)
   m68ki_jump_vector(EXCEPTION_ADDRESS_ERROR);
 
   /* Use up some clock cycles and undo the instruction's cycles */
-  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ADDRESS_ERROR] - CYC_INSTRUCTION[REG_IR]);
+  USE_CYCLES(CYC_EXCEPTION[EXCEPTION_ADDRESS_ERROR] - CYC_INSTRUCTION(REG_IR));
 }
 #endif
 
@@ -1407,6 +1804,53 @@ INLINE void m68ki_check_interrupts(void)
     m68ki_exception_interrupt(CPU_INT_LEVEL>>8);
 }
 
+#if M68K_INSTRUCTION_CACHE
+/* Execute instructions from predecoded trace starting at current PC */
+static void m68ki_cache_execute(uint cycles)
+{
+  m68ki_cache_trace *trace = &m68ki_cache[(REG_PC >> 1) & (M68K_CACHE_TRACES - 1)];
+  m68ki_cache_entry *entry = trace->entry;
+
+  /* Execute recorded trace until program flow leaves it */
+  if (trace->count && (entry->pc == REG_PC))
+  {
+    m68ki_cache_entry *last = entry + trace->count;
+
+    do
+    {
+      /* Code might have been modified or remapped since it was recorded */
+      if (m68k_read_immediate_16(REG_PC) != entry->ir)
+      {
+        trace->count = entry - trace->entry;
+        return;
+      }
+
+      REG_IR = entry->ir;
+      REG_PC += 2;
+      entry->handler();
+      USE_CYCLES(entry->cycles);
+    }
+    while ((++entry < last) && (entry->pc == REG_PC) && (m68ki_cpu.cycles < cycles));
+
+    return;
+  }
+
+  /* Record new trace while executing instructions */
+  trace->count = 0;
+  do
+  {
+    entry = &trace->entry[trace->count++];
+    entry->pc = REG_PC;
+    entry->ir = REG_IR = m68ki_read_imm_16();
+    entry->handler = m68ki_instruction_handler(REG_IR);
+    entry->cycles = CYC_INSTRUCTION(REG_IR);
+    entry->handler();
+    USE_CYCLES(entry->cycles);
+  }
+  while ((trace->count < M68K_CACHE_LENGTH) && (m68ki_cpu.cycles < cycles));
+}
+#endif
+
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
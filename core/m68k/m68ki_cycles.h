@@ -1,4099 +0,0 @@
-static const unsigned char m68ki_cycles[0x10000] =
-{
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,   0*7,   0*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7, 
-   34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  34*7,  32*7,  36*7,  32*7,  34*7,  28*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7, 
-   30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  28*7,  32*7,  28*7,  30*7,  24*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7, 
-   28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  28*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  32*7,  30*7,  34*7,  30*7,  32*7,  26*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,  24*7,  26*7,  20*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,  22*7,  24*7,  18*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  20*7,  24*7,  20*7,  22*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  16*7,  20*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7, 
-   24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  22*7,  26*7,   0*7,   0*7,   4*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   4*7,   4*7,  20*7,   0*7,  16*7,   4*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  18*7,  20*7,  18*7,  22*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  10*7,  12*7,  10*7,  14*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,   8*7,  12*7,   8*7,  12*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  14*7,  18*7,  14*7,  16*7,  10*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  14*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,   8*7,  12*7,   8*7,  10*7,   4*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  10*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  12*7,  16*7,  12*7,  14*7,   8*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,  16*7,  18*7,  12*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7,  30*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7, 
-   22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  22*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7,  24*7, 
-   26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  26*7,  24*7,  28*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7, 
-   16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7, 
-   20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  20*7,  18*7,  22*7,  18*7,  20*7,  16*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-   12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7,  12*7, 
-   14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  14*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7,  16*7, 
-   18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  18*7,  16*7,  20*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7,   6*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7,   8*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7,   0*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-    4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7,   4*7, 
-};
@@ -0,0 +1,1634 @@
+/* Opcode handlers, shared by both CPU cores (indexed by instruction word bits 15-4) */
+const unsigned short m68ki_opcode_page[0x1000] =
+{
+      0,    16,    32,    48,    64,    80,    96,   112,   128,   144,   160,   176,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+    464,   480,   496,   512,   528,   544,   560,   576,   592,   608,   624,   640,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+    656,   672,   688,   704,   720,   736,   752,   768,   784,   800,   816,   832,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+    848,   864,   880,   896,   912,   928,   944,   960,   976,   992,  1008,  1024,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+   1040,  1056,  1072,  1088,  1104,  1120,  1136,  1152,  1168,  1184,  1200,  1216,  1232,  1248,  1264,  1280,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+   1296,  1312,  1328,  1344,  1360,  1376,  1392,  1408,  1424,  1440,  1456,  1472,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+   1488,  1504,  1520,  1536,  1552,  1568,  1584,  1600,  1616,  1632,  1648,  1664,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+    208,   224,   240,   256,   272,   288,   304,   320,   336,   352,   368,   384,   400,   416,   432,   448,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,  2064,  2080,  2096,  2112,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,  2128,  2144,  2160,  2176,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  1808,  1824,  1840,  1856,
+   1872,  1888,  1904,  1920,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   1680,  1696,  1712,  1728,   192,   192,   192,   192,  1744,  1760,  1776,  1792,  2192,  2208,  2224,  2240,
+   2256,  2272,  2288,  2304,  1936,  1952,  1968,  1984,  2000,  2016,  2032,  2048,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,  2768,  2784,  2800,  2816,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,  2832,  2848,  2864,  2880,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2320,  2336,  2352,  2368,  2384,  2400,  2416,  2432,  2448,  2464,  2480,  2496,  2512,  2528,  2544,  2560,
+   2576,  2592,  2608,  2624,  2640,  2656,  2672,  2688,  2704,  2720,  2736,  2752,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,  3344,  3360,  3376,  3392,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,  3408,  3424,  3440,  3456,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   2896,  2912,  2928,  2944,  2960,  2976,  2992,  3008,  3024,  3040,  3056,  3072,  3088,  3104,  3120,  3136,
+   3152,  3168,  3184,  3200,  3216,  3232,  3248,  3264,  3280,  3296,  3312,  3328,   192,   192,   192,   192,
+   3472,  3488,  3504,  3520,  3536,  3552,  3568,  3584,  3600,  3616,  3632,  3648,  3664,  3680,  3696,  3712,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   3840,  3856,  3872,  3888,  3904,  3920,  3936,  3952,  3968,  3984,  4000,  4016,   192,   192,   192,   192,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   4032,  4048,  4064,  4080,  4096,  4112,  4128,  4144,  4160,  4176,  4192,  4208,  4224,  4240,  4256,  4272,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   4288,  4304,  4320,  4336,  4352,  4368,  4384,  4400,  4416,  4432,  4448,  4464,  4480,  4496,  4512,  4528,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   4544,  4560,  4576,  4592,  4608,  4624,  4640,  4656,  4672,  4688,  4704,  4720,  4736,  4752,  4768,  4784,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   4800,  4816,  4832,  4848,  4864,  4880,  4896,  4912,  4928,  4944,  4960,  4976,  4992,  5008,  5024,  5040,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,  5056,  5072,  5088,   192,  5104,  5120,  5136,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+    192,   192,   192,   192,  5152,  5168,  5184,  5200,   192,  5216,  5232,  5248,   192,  5264,  5280,  5296,
+    192,   192,   192,   192,   192,   192,   192,   192,  3728,  3744,  3760,  3776,   192,  3792,  3808,  3824,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  5504,  5520,  5536,  5552,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  5760,  5776,  5792,  5808,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  5824,  5840,  5856,  5872,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  5888,  5904,  5920,  5936,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  5952,  5968,  5984,  6000,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6016,  6032,  6048,  6064,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  6080,  6096,  6112,  6128,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6144,  6160,  6176,  6192,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  6208,  6224,  6240,  6256,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6272,  6288,  6304,  6320,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  6336,  6352,  6368,  6384,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6400,  6416,  6432,  6448,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  6464,  6480,  6496,  6512,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6528,  6544,  6560,  6576,
+   5312,  5328,  5344,  5360,  5376,  5392,  5408,  5424,  5440,  5456,  5472,  5488,  6592,  6608,  6624,  6640,
+   5568,  5584,  5600,  5616,  5632,  5648,  5664,  5680,  5696,  5712,  5728,  5744,  6656,  6672,  6688,  6704,
+   6720,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6736,  6752,
+   6768,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6784,  6800,
+   6816,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6832,  6848,
+   6864,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6880,  6896,
+   6912,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6928,  6944,
+   6960,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6976,  6992,
+   7008,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7024,  7040,
+   7056,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7072,  7088,
+   7104,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7120,  7136,
+   7152,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7168,  7184,
+   7200,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7216,  7232,
+   7248,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7264,  7280,
+   7296,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7312,  7328,
+   7344,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7360,  7376,
+   7392,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7408,  7424,
+   7440,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7456,  7472,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,  7488,
+    192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,   192,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7760,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   7504,  7520,  7536,  7552,  7568,  7584,  7600,  7616,  7632,  7648,  7664,  7680,  7696,  7712,  7728,  7744,
+   7984,  7776,  7792,  7808,   192,  7824,  7840,  7856,   192,  7872,  7888,  7904,  7920,  7936,  7952,  7968,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8256,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8000,  8016,  8032,  8048,  8064,  8080,  8096,  8112,  8128,  8144,  8160,  8176,  8192,  8208,  8224,  8240,
+   8512,  8272,  8288,  8304,  8320,  8336,  8352,  8368,  8384,  8400,  8416,  8432,  8448,  8464,  8480,  8496,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,  8528,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   8800,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   8544,  8560,  8576,  8592,  8608,  8624,  8640,  8656,  8672,  8688,  8704,  8720,  8736,  8752,  8768,  8784,
+   9056,  8816,  8832,  8848,  8864,  8880,  8896,  8912,  8928,  8944,  8960,  8976,  8992,  9008,  9024,  9040,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9328,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9072,  9088,  9104,  9120,  9136,  9152,  9168,  9184,  9200,  9216,  9232,  9248,  9264,  9280,  9296,  9312,
+   9584,  9344,  9360,  9376,  9392,  9408,  9424,  9440,  9456,  9472,  9488,  9504,  9520,  9536,  9552,  9568,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+   9856,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+   9600,  9616,  9632,  9648,  9664,  9680,  9696,  9712,  9728,  9744,  9760,  9776,  9792,  9808,  9824,  9840,
+  10112,  9872,  9888,  9904,  9920,  9936,  9952,  9968,  9984, 10000, 10016, 10032, 10048, 10064, 10080, 10096,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192, 10320, 10336, 10352,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192, 10560, 10576, 10592,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192, 10608, 10624, 10640,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192, 10656, 10672, 10688,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192, 10704, 10720, 10736,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192, 10752, 10768, 10784,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192, 10800, 10816, 10832,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192, 10848, 10864, 10880,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192,   192,   192,   192,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192,   192,   192,   192,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192,   192,   192,   192,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192,   192,   192,   192,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192,   192,   192,   192,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192,   192,   192,   192,
+  10128, 10144, 10160, 10176, 10192, 10208, 10224, 10240, 10256, 10272, 10288, 10304,   192,   192,   192,   192,
+  10368, 10384, 10400, 10416, 10432, 10448, 10464, 10480, 10496, 10512, 10528, 10544,   192,   192,   192,   192,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+  10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896, 10896,
+};
+
+/* Opcode handler index (indexed by page offset + instruction word bits 3-0) */
+const unsigned short m68ki_opcode_handler[10912] =
+{
+     0,    0,    0,    0,    0,    0,    0,    0,    1,    1,    1,    1,    1,    1,    1,    1,
+     2,    2,    2,    2,    2,    2,    2,    2,    3,    3,    3,    3,    3,    3,    3,    4,
+     5,    5,    5,    5,    5,    5,    5,    6,    7,    7,    7,    7,    7,    7,    7,    7,
+     8,    8,    8,    8,    8,    8,    8,    8,    9,   10,    1,    1,   11,    1,    1,    1,
+    12,   12,   12,   12,   12,   12,   12,   12,    1,    1,    1,    1,    1,    1,    1,    1,
+    13,   13,   13,   13,   13,   13,   13,   13,   14,   14,   14,   14,   14,   14,   14,   14,
+    15,   15,   15,   15,   15,   15,   15,   15,   16,   16,   16,   16,   16,   16,   16,   16,
+    17,   17,   17,   17,   17,   17,   17,   17,   18,   19,    1,    1,   20,    1,    1,    1,
+    21,   21,   21,   21,   21,   21,   21,   21,    1,    1,    1,    1,    1,    1,    1,    1,
+    22,   22,   22,   22,   22,   22,   22,   22,   23,   23,   23,   23,   23,   23,   23,   23,
+    24,   24,   24,   24,   24,   24,   24,   24,   25,   25,   25,   25,   25,   25,   25,   25,
+    26,   26,   26,   26,   26,   26,   26,   26,   27,   28,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+    29,   29,   29,   29,   29,   29,   29,   29,   30,   30,   30,   30,   30,   30,   30,   30,
+    31,   31,   31,   31,   31,   31,   31,   31,   32,   32,   32,   32,   32,   32,   32,   33,
+    34,   34,   34,   34,   34,   34,   34,   35,   36,   36,   36,   36,   36,   36,   36,   36,
+    37,   37,   37,   37,   37,   37,   37,   37,   38,   39,   40,   41,   42,    1,    1,    1,
+    43,   43,   43,   43,   43,   43,   43,   43,   44,   44,   44,   44,   44,   44,   44,   44,
+    45,   45,   45,   45,   45,   45,   45,   45,   46,   46,   46,   46,   46,   46,   46,   47,
+    48,   48,   48,   48,   48,   48,   48,   49,   50,   50,   50,   50,   50,   50,   50,   50,
+    51,   51,   51,   51,   51,   51,   51,   51,   52,   53,    1,    1,    1,    1,    1,    1,
+    54,   54,   54,   54,   54,   54,   54,   54,   55,   55,   55,   55,   55,   55,   55,   55,
+    56,   56,   56,   56,   56,   56,   56,   56,   57,   57,   57,   57,   57,   57,   57,   58,
+    59,   59,   59,   59,   59,   59,   59,   60,   61,   61,   61,   61,   61,   61,   61,   61,
+    62,   62,   62,   62,   62,   62,   62,   62,   63,   64,    1,    1,    1,    1,    1,    1,
+    65,   65,   65,   65,   65,   65,   65,   65,   66,   66,   66,   66,   66,   66,   66,   66,
+    67,   67,   67,   67,   67,   67,   67,   67,   68,   68,   68,   68,   68,   68,   68,   69,
+    70,   70,   70,   70,   70,   70,   70,   71,   72,   72,   72,   72,   72,   72,   72,   72,
+    73,   73,   73,   73,   73,   73,   73,   73,   74,   75,    1,    1,    1,    1,    1,    1,
+    76,   76,   76,   76,   76,   76,   76,   76,    1,    1,    1,    1,    1,    1,    1,    1,
+    77,   77,   77,   77,   77,   77,   77,   77,   78,   78,   78,   78,   78,   78,   78,   79,
+    80,   80,   80,   80,   80,   80,   80,   81,   82,   82,   82,   82,   82,   82,   82,   82,
+    83,   83,   83,   83,   83,   83,   83,   83,   84,   85,    1,    1,   86,    1,    1,    1,
+    87,   87,   87,   87,   87,   87,   87,   87,    1,    1,    1,    1,    1,    1,    1,    1,
+    88,   88,   88,   88,   88,   88,   88,   88,   89,   89,   89,   89,   89,   89,   89,   89,
+    90,   90,   90,   90,   90,   90,   90,   90,   91,   91,   91,   91,   91,   91,   91,   91,
+    92,   92,   92,   92,   92,   92,   92,   92,   93,   94,    1,    1,   95,    1,    1,    1,
+    96,   96,   96,   96,   96,   96,   96,   96,    1,    1,    1,    1,    1,    1,    1,    1,
+    97,   97,   97,   97,   97,   97,   97,   97,   98,   98,   98,   98,   98,   98,   98,   98,
+    99,   99,   99,   99,   99,   99,   99,   99,  100,  100,  100,  100,  100,  100,  100,  100,
+   101,  101,  101,  101,  101,  101,  101,  101,  102,  103,    1,    1,    1,    1,    1,    1,
+   104,  104,  104,  104,  104,  104,  104,  104,    1,    1,    1,    1,    1,    1,    1,    1,
+   105,  105,  105,  105,  105,  105,  105,  105,  106,  106,  106,  106,  106,  106,  106,  107,
+   108,  108,  108,  108,  108,  108,  108,  109,  110,  110,  110,  110,  110,  110,  110,  110,
+   111,  111,  111,  111,  111,  111,  111,  111,  112,  113,    1,    1,    1,    1,    1,    1,
+   114,  114,  114,  114,  114,  114,  114,  114,    1,    1,    1,    1,    1,    1,    1,    1,
+   115,  115,  115,  115,  115,  115,  115,  115,  116,  116,  116,  116,  116,  116,  116,  116,
+   117,  117,  117,  117,  117,  117,  117,  117,  118,  118,  118,  118,  118,  118,  118,  118,
+   119,  119,  119,  119,  119,  119,  119,  119,  120,  121,    1,    1,    1,    1,    1,    1,
+   122,  122,  122,  122,  122,  122,  122,  122,    1,    1,    1,    1,    1,    1,    1,    1,
+   123,  123,  123,  123,  123,  123,  123,  123,  124,  124,  124,  124,  124,  124,  124,  124,
+   125,  125,  125,  125,  125,  125,  125,  125,  126,  126,  126,  126,  126,  126,  126,  126,
+   127,  127,  127,  127,  127,  127,  127,  127,  128,  129,    1,    1,    1,    1,    1,    1,
+   130,  130,  130,  130,  130,  130,  130,  130,    1,    1,    1,    1,    1,    1,    1,    1,
+   131,  131,  131,  131,  131,  131,  131,  131,  132,  132,  132,  132,  132,  132,  132,  133,
+   134,  134,  134,  134,  134,  134,  134,  135,  136,  136,  136,  136,  136,  136,  136,  136,
+   137,  137,  137,  137,  137,  137,  137,  137,  138,  139,    1,    1,    1,    1,    1,    1,
+   140,  140,  140,  140,  140,  140,  140,  140,    1,    1,    1,    1,    1,    1,    1,    1,
+   141,  141,  141,  141,  141,  141,  141,  141,  142,  142,  142,  142,  142,  142,  142,  142,
+   143,  143,  143,  143,  143,  143,  143,  143,  144,  144,  144,  144,  144,  144,  144,  144,
+   145,  145,  145,  145,  145,  145,  145,  145,  146,  147,    1,    1,    1,    1,    1,    1,
+   148,  148,  148,  148,  148,  148,  148,  148,    1,    1,    1,    1,    1,    1,    1,    1,
+   149,  149,  149,  149,  149,  149,  149,  149,  150,  150,  150,  150,  150,  150,  150,  150,
+   151,  151,  151,  151,  151,  151,  151,  151,  152,  152,  152,  152,  152,  152,  152,  152,
+   153,  153,  153,  153,  153,  153,  153,  153,  154,  155,    1,    1,    1,    1,    1,    1,
+   156,  156,  156,  156,  156,  156,  156,  156,    1,    1,    1,    1,    1,    1,    1,    1,
+   157,  157,  157,  157,  157,  157,  157,  157,  158,  158,  158,  158,  158,  158,  158,  159,
+   160,  160,  160,  160,  160,  160,  160,  161,  162,  162,  162,  162,  162,  162,  162,  162,
+   163,  163,  163,  163,  163,  163,  163,  163,  164,  165,  166,  167,    1,    1,    1,    1,
+   168,  168,  168,  168,  168,  168,  168,  168,    1,    1,    1,    1,    1,    1,    1,    1,
+   169,  169,  169,  169,  169,  169,  169,  169,  170,  170,  170,  170,  170,  170,  170,  171,
+   172,  172,  172,  172,  172,  172,  172,  173,  174,  174,  174,  174,  174,  174,  174,  174,
+   175,  175,  175,  175,  175,  175,  175,  175,  176,  177,    1,    1,    1,    1,    1,    1,
+   178,  178,  178,  178,  178,  178,  178,  178,    1,    1,    1,    1,    1,    1,    1,    1,
+   179,  179,  179,  179,  179,  179,  179,  179,  180,  180,  180,  180,  180,  180,  180,  181,
+   182,  182,  182,  182,  182,  182,  182,  183,  184,  184,  184,  184,  184,  184,  184,  184,
+   185,  185,  185,  185,  185,  185,  185,  185,  186,  187,    1,    1,    1,    1,    1,    1,
+   188,  188,  188,  188,  188,  188,  188,  188,    1,    1,    1,    1,    1,    1,    1,    1,
+   189,  189,  189,  189,  189,  189,  189,  189,  190,  190,  190,  190,  190,  190,  190,  191,
+   192,  192,  192,  192,  192,  192,  192,  193,  194,  194,  194,  194,  194,  194,  194,  194,
+   195,  195,  195,  195,  195,  195,  195,  195,  196,  197,    1,    1,    1,    1,    1,    1,
+   198,  198,  198,  198,  198,  198,  198,  198,    1,    1,    1,    1,    1,    1,    1,    1,
+   199,  199,  199,  199,  199,  199,  199,  199,  200,  200,  200,  200,  200,  200,  200,  201,
+   202,  202,  202,  202,  202,  202,  202,  203,  204,  204,  204,  204,  204,  204,  204,  204,
+   205,  205,  205,  205,  205,  205,  205,  205,  206,  207,    1,    1,  208,    1,    1,    1,
+   209,  209,  209,  209,  209,  209,  209,  209,    1,    1,    1,    1,    1,    1,    1,    1,
+   210,  210,  210,  210,  210,  210,  210,  210,  211,  211,  211,  211,  211,  211,  211,  211,
+   212,  212,  212,  212,  212,  212,  212,  212,  213,  213,  213,  213,  213,  213,  213,  213,
+   214,  214,  214,  214,  214,  214,  214,  214,  215,  216,    1,    1,  217,    1,    1,    1,
+   218,  218,  218,  218,  218,  218,  218,  218,    1,    1,    1,    1,    1,    1,    1,    1,
+   219,  219,  219,  219,  219,  219,  219,  219,  220,  220,  220,  220,  220,  220,  220,  220,
+   221,  221,  221,  221,  221,  221,  221,  221,  222,  222,  222,  222,  222,  222,  222,  222,
+   223,  223,  223,  223,  223,  223,  223,  223,  224,  225,    1,    1,    1,    1,    1,    1,
+   226,  226,  226,  226,  226,  226,  226,  226,    1,    1,    1,    1,    1,    1,    1,    1,
+   227,  227,  227,  227,  227,  227,  227,  227,  228,  228,  228,  228,  228,  228,  228,  229,
+   230,  230,  230,  230,  230,  230,  230,  231,  232,  232,  232,  232,  232,  232,  232,  232,
+   233,  233,  233,  233,  233,  233,  233,  233,  234,  235,    1,    1,    1,    1,    1,    1,
+   236,  236,  236,  236,  236,  236,  236,  236,    1,    1,    1,    1,    1,    1,    1,    1,
+   237,  237,  237,  237,  237,  237,  237,  237,  238,  238,  238,  238,  238,  238,  238,  238,
+   239,  239,  239,  239,  239,  239,  239,  239,  240,  240,  240,  240,  240,  240,  240,  240,
+   241,  241,  241,  241,  241,  241,  241,  241,  242,  243,    1,    1,    1,    1,    1,    1,
+   244,  244,  244,  244,  244,  244,  244,  244,    1,    1,    1,    1,    1,    1,    1,    1,
+   245,  245,  245,  245,  245,  245,  245,  245,  246,  246,  246,  246,  246,  246,  246,  246,
+   247,  247,  247,  247,  247,  247,  247,  247,  248,  248,  248,  248,  248,  248,  248,  248,
+   249,  249,  249,  249,  249,  249,  249,  249,  250,  251,    1,    1,    1,    1,    1,    1,
+   252,  252,  252,  252,  252,  252,  252,  252,    1,    1,    1,    1,    1,    1,    1,    1,
+   253,  253,  253,  253,  253,  253,  253,  253,  254,  254,  254,  254,  254,  254,  254,  255,
+   256,  256,  256,  256,  256,  256,  256,  257,  258,  258,  258,  258,  258,  258,  258,  258,
+   259,  259,  259,  259,  259,  259,  259,  259,  260,  261,  262,  263,  264,    1,    1,    1,
+   265,  265,  265,  265,  265,  265,  265,  265,    1,    1,    1,    1,    1,    1,    1,    1,
+   266,  266,  266,  266,  266,  266,  266,  266,  267,  267,  267,  267,  267,  267,  267,  268,
+   269,  269,  269,  269,  269,  269,  269,  270,  271,  271,  271,  271,  271,  271,  271,  271,
+   272,  272,  272,  272,  272,  272,  272,  272,  273,  274,  275,  276,  277,    1,    1,    1,
+   278,  278,  278,  278,  278,  278,  278,  278,    1,    1,    1,    1,    1,    1,    1,    1,
+   279,  279,  279,  279,  279,  279,  279,  279,  280,  280,  280,  280,  280,  280,  280,  281,
+   282,  282,  282,  282,  282,  282,  282,  283,  284,  284,  284,  284,  284,  284,  284,  284,
+   285,  285,  285,  285,  285,  285,  285,  285,  286,  287,  288,  289,  290,    1,    1,    1,
+   291,  291,  291,  291,  291,  291,  291,  291,    1,    1,    1,    1,    1,    1,    1,    1,
+   292,  292,  292,  292,  292,  292,  292,  292,  293,  293,  293,  293,  293,  293,  293,  294,
+   295,  295,  295,  295,  295,  295,  295,  296,  297,  297,  297,  297,  297,  297,  297,  297,
+   298,  298,  298,  298,  298,  298,  298,  298,  299,  300,  301,  302,  303,    1,    1,    1,
+   304,  304,  304,  304,  304,  304,  304,  304,    1,    1,    1,    1,    1,    1,    1,    1,
+   305,  305,  305,  305,  305,  305,  305,  305,  306,  306,  306,  306,  306,  306,  306,  307,
+   308,  308,  308,  308,  308,  308,  308,  309,  310,  310,  310,  310,  310,  310,  310,  310,
+   311,  311,  311,  311,  311,  311,  311,  311,  312,  313,  314,  315,  316,    1,    1,    1,
+   317,  317,  317,  317,  317,  317,  317,  317,    1,    1,    1,    1,    1,    1,    1,    1,
+   318,  318,  318,  318,  318,  318,  318,  318,  319,  319,  319,  319,  319,  319,  319,  320,
+   321,  321,  321,  321,  321,  321,  321,  322,  323,  323,  323,  323,  323,  323,  323,  323,
+   324,  324,  324,  324,  324,  324,  324,  324,  325,  326,  327,  328,  329,    1,    1,    1,
+   330,  330,  330,  330,  330,  330,  330,  330,    1,    1,    1,    1,    1,    1,    1,    1,
+   331,  331,  331,  331,  331,  331,  331,  331,  332,  332,  332,  332,  332,  332,  332,  333,
+   334,  334,  334,  334,  334,  334,  334,  335,  336,  336,  336,  336,  336,  336,  336,  336,
+   337,  337,  337,  337,  337,  337,  337,  337,  338,  339,  340,  341,  342,    1,    1,    1,
+   343,  343,  343,  343,  343,  343,  343,  343,    1,    1,    1,    1,    1,    1,    1,    1,
+   344,  344,  344,  344,  344,  344,  344,  344,  345,  345,  345,  345,  345,  345,  345,  346,
+   347,  347,  347,  347,  347,  347,  347,  348,  349,  349,  349,  349,  349,  349,  349,  349,
+   350,  350,  350,  350,  350,  350,  350,  350,  351,  352,  353,  354,  355,    1,    1,    1,
+   356,  356,  356,  356,  356,  356,  356,  356,    1,    1,    1,    1,    1,    1,    1,    1,
+   357,  357,  357,  357,  357,  357,  357,  357,  358,  358,  358,  358,  358,  358,  358,  359,
+   360,  360,  360,  360,  360,  360,  360,  361,  362,  362,  362,  362,  362,  362,  362,  362,
+   363,  363,  363,  363,  363,  363,  363,  363,  364,  365,  366,  367,  368,    1,    1,    1,
+   369,  369,  369,  369,  369,  369,  369,  369,    1,    1,    1,    1,    1,    1,    1,    1,
+   370,  370,  370,  370,  370,  370,  370,  370,  371,  371,  371,  371,  371,  371,  371,  372,
+   373,  373,  373,  373,  373,  373,  373,  374,  375,  375,  375,  375,  375,  375,  375,  375,
+   376,  376,  376,  376,  376,  376,  376,  376,  377,  378,  379,  380,  381,    1,    1,    1,
+   382,  382,  382,  382,  382,  382,  382,  382,  383,  383,  383,  383,  383,  383,  383,  383,
+   384,  384,  384,  384,  384,  384,  384,  384,  385,  385,  385,  385,  385,  385,  385,  385,
+   386,  386,  386,  386,  386,  386,  386,  386,  387,  387,  387,  387,  387,  387,  387,  387,
+   388,  388,  388,  388,  388,  388,  388,  388,  389,  390,  391,  392,  393,    1,    1,    1,
+   394,  394,  394,  394,  394,  394,  394,  394,  395,  395,  395,  395,  395,  395,  395,  395,
+   396,  396,  396,  396,  396,  396,  396,  396,  397,  397,  397,  397,  397,  397,  397,  397,
+   398,  398,  398,  398,  398,  398,  398,  398,  399,  399,  399,  399,  399,  399,  399,  399,
+   400,  400,  400,  400,  400,  400,  400,  400,  401,  402,  403,  404,  405,    1,    1,    1,
+   406,  406,  406,  406,  406,  406,  406,  406,  407,  407,  407,  407,  407,  407,  407,  407,
+   408,  408,  408,  408,  408,  408,  408,  408,  409,  409,  409,  409,  409,  409,  409,  409,
+   410,  410,  410,  410,  410,  410,  410,  410,  411,  411,  411,  411,  411,  411,  411,  411,
+   412,  412,  412,  412,  412,  412,  412,  412,  413,  414,  415,  416,  417,    1,    1,    1,
+   418,  418,  418,  418,  418,  418,  418,  418,  419,  419,  419,  419,  419,  419,  419,  419,
+   420,  420,  420,  420,  420,  420,  420,  420,  421,  421,  421,  421,  421,  421,  421,  421,
+   422,  422,  422,  422,  422,  422,  422,  422,  423,  423,  423,  423,  423,  423,  423,  423,
+   424,  424,  424,  424,  424,  424,  424,  424,  425,  426,  427,  428,  429,    1,    1,    1,
+   430,  430,  430,  430,  430,  430,  430,  430,  431,  431,  431,  431,  431,  431,  431,  431,
+   432,  432,  432,  432,  432,  432,  432,  432,  433,  433,  433,  433,  433,  433,  433,  433,
+   434,  434,  434,  434,  434,  434,  434,  434,  435,  435,  435,  435,  435,  435,  435,  435,
+   436,  436,  436,  436,  436,  436,  436,  436,  437,  438,  439,  440,  441,    1,    1,    1,
+   442,  442,  442,  442,  442,  442,  442,  442,  443,  443,  443,  443,  443,  443,  443,  443,
+   444,  444,  444,  444,  444,  444,  444,  444,  445,  445,  445,  445,  445,  445,  445,  445,
+   446,  446,  446,  446,  446,  446,  446,  446,  447,  447,  447,  447,  447,  447,  447,  447,
+   448,  448,  448,  448,  448,  448,  448,  448,  449,  450,  451,  452,  453,    1,    1,    1,
+   454,  454,  454,  454,  454,  454,  454,  454,  455,  455,  455,  455,  455,  455,  455,  455,
+   456,  456,  456,  456,  456,  456,  456,  456,  457,  457,  457,  457,  457,  457,  457,  457,
+   458,  458,  458,  458,  458,  458,  458,  458,  459,  459,  459,  459,  459,  459,  459,  459,
+   460,  460,  460,  460,  460,  460,  460,  460,  461,  462,  463,  464,  465,    1,    1,    1,
+   466,  466,  466,  466,  466,  466,  466,  466,  467,  467,  467,  467,  467,  467,  467,  467,
+   468,  468,  468,  468,  468,  468,  468,  468,  469,  469,  469,  469,  469,  469,  469,  469,
+   470,  470,  470,  470,  470,  470,  470,  470,  471,  471,  471,  471,  471,  471,  471,  471,
+   472,  472,  472,  472,  472,  472,  472,  472,  473,  474,  475,  476,  477,    1,    1,    1,
+   478,  478,  478,  478,  478,  478,  478,  478,  479,  479,  479,  479,  479,  479,  479,  479,
+   480,  480,  480,  480,  480,  480,  480,  480,  481,  481,  481,  481,  481,  481,  481,  481,
+   482,  482,  482,  482,  482,  482,  482,  482,  483,  483,  483,  483,  483,  483,  483,  483,
+   484,  484,  484,  484,  484,  484,  484,  484,  485,  486,  487,  488,  489,    1,    1,    1,
+   490,  490,  490,  490,  490,  490,  490,  490,  491,  491,  491,  491,  491,  491,  491,  491,
+   492,  492,  492,  492,  492,  492,  492,  492,  493,  493,  493,  493,  493,  493,  493,  493,
+   494,  494,  494,  494,  494,  494,  494,  494,  495,  495,  495,  495,  495,  495,  495,  495,
+   496,  496,  496,  496,  496,  496,  496,  496,  497,  498,  499,  500,  501,    1,    1,    1,
+   502,  502,  502,  502,  502,  502,  502,  502,  503,  503,  503,  503,  503,  503,  503,  503,
+   504,  504,  504,  504,  504,  504,  504,  504,  505,  505,  505,  505,  505,  505,  505,  505,
+   506,  506,  506,  506,  506,  506,  506,  506,  507,  507,  507,  507,  507,  507,  507,  507,
+   508,  508,  508,  508,  508,  508,  508,  508,  509,  510,  511,  512,  513,    1,    1,    1,
+   514,  514,  514,  514,  514,  514,  514,  514,  515,  515,  515,  515,  515,  515,  515,  515,
+   516,  516,  516,  516,  516,  516,  516,  516,  517,  517,  517,  517,  517,  517,  517,  517,
+   518,  518,  518,  518,  518,  518,  518,  518,  519,  519,  519,  519,  519,  519,  519,  519,
+   520,  520,  520,  520,  520,  520,  520,  520,  521,  522,  523,  524,  525,    1,    1,    1,
+   526,  526,  526,  526,  526,  526,  526,  526,  527,  527,  527,  527,  527,  527,  527,  527,
+   528,  528,  528,  528,  528,  528,  528,  528,  529,  529,  529,  529,  529,  529,  529,  529,
+   530,  530,  530,  530,  530,  530,  530,  530,  531,  531,  531,  531,  531,  531,  531,  531,
+   532,  532,  532,  532,  532,  532,  532,  532,  533,  534,  535,  536,  537,    1,    1,    1,
+   538,  538,  538,  538,  538,  538,  538,  538,  539,  539,  539,  539,  539,  539,  539,  539,
+   540,  540,  540,  540,  540,  540,  540,  540,  541,  541,  541,  541,  541,  541,  541,  541,
+   542,  542,  542,  542,  542,  542,  542,  542,  543,  543,  543,  543,  543,  543,  543,  543,
+   544,  544,  544,  544,  544,  544,  544,  544,  545,  546,  547,  548,  549,    1,    1,    1,
+   550,  550,  550,  550,  550,  550,  550,  550,  551,  551,  551,  551,  551,  551,  551,  551,
+   552,  552,  552,  552,  552,  552,  552,  552,  553,  553,  553,  553,  553,  553,  553,  553,
+   554,  554,  554,  554,  554,  554,  554,  554,  555,  555,  555,  555,  555,  555,  555,  555,
+   556,  556,  556,  556,  556,  556,  556,  556,  557,  558,  559,  560,  561,    1,    1,    1,
+   562,  562,  562,  562,  562,  562,  562,  562,  563,  563,  563,  563,  563,  563,  563,  563,
+   564,  564,  564,  564,  564,  564,  564,  564,  565,  565,  565,  565,  565,  565,  565,  565,
+   566,  566,  566,  566,  566,  566,  566,  566,  567,  567,  567,  567,  567,  567,  567,  567,
+   568,  568,  568,  568,  568,  568,  568,  568,  569,  570,  571,  572,  573,    1,    1,    1,
+   574,  574,  574,  574,  574,  574,  574,  574,  575,  575,  575,  575,  575,  575,  575,  575,
+   576,  576,  576,  576,  576,  576,  576,  576,  577,  577,  577,  577,  577,  577,  577,  577,
+   578,  578,  578,  578,  578,  578,  578,  578,  579,  579,  579,  579,  579,  579,  579,  579,
+   580,  580,  580,  580,  580,  580,  580,  580,  581,  582,  583,  584,  585,    1,    1,    1,
+   586,  586,  586,  586,  586,  586,  586,  586,  587,  587,  587,  587,  587,  587,  587,  587,
+   588,  588,  588,  588,  588,  588,  588,  588,  589,  589,  589,  589,  589,  589,  589,  589,
+   590,  590,  590,  590,  590,  590,  590,  590,  591,  591,  591,  591,  591,  591,  591,  591,
+   592,  592,  592,  592,  592,  592,  592,  592,  593,  594,  595,  596,  597,    1,    1,    1,
+   598,  598,  598,  598,  598,  598,  598,  598,    1,    1,    1,    1,    1,    1,    1,    1,
+   599,  599,  599,  599,  599,  599,  599,  599,  600,  600,  600,  600,  600,  600,  600,  601,
+   602,  602,  602,  602,  602,  602,  602,  603,  604,  604,  604,  604,  604,  604,  604,  604,
+   605,  605,  605,  605,  605,  605,  605,  605,  606,  607,    1,    1,    1,    1,    1,    1,
+   608,  608,  608,  608,  608,  608,  608,  608,    1,    1,    1,    1,    1,    1,    1,    1,
+   609,  609,  609,  609,  609,  609,  609,  609,  610,  610,  610,  610,  610,  610,  610,  610,
+   611,  611,  611,  611,  611,  611,  611,  611,  612,  612,  612,  612,  612,  612,  612,  612,
+   613,  613,  613,  613,  613,  613,  613,  613,  614,  615,    1,    1,    1,    1,    1,    1,
+   616,  616,  616,  616,  616,  616,  616,  616,    1,    1,    1,    1,    1,    1,    1,    1,
+   617,  617,  617,  617,  617,  617,  617,  617,  618,  618,  618,  618,  618,  618,  618,  618,
+   619,  619,  619,  619,  619,  619,  619,  619,  620,  620,  620,  620,  620,  620,  620,  620,
+   621,  621,  621,  621,  621,  621,  621,  621,  622,  623,    1,    1,    1,    1,    1,    1,
+   624,  624,  624,  624,  624,  624,  624,  624,    1,    1,    1,    1,    1,    1,    1,    1,
+   625,  625,  625,  625,  625,  625,  625,  625,  626,  626,  626,  626,  626,  626,  626,  626,
+   627,  627,  627,  627,  627,  627,  627,  627,  628,  628,  628,  628,  628,  628,  628,  628,
+   629,  629,  629,  629,  629,  629,  629,  629,  630,  631,    1,    1,    1,    1,    1,    1,
+   632,  632,  632,  632,  632,  632,  632,  632,    1,    1,    1,    1,    1,    1,    1,    1,
+   633,  633,  633,  633,  633,  633,  633,  633,  634,  634,  634,  634,  634,  634,  634,  634,
+   635,  635,  635,  635,  635,  635,  635,  635,  636,  636,  636,  636,  636,  636,  636,  636,
+   637,  637,  637,  637,  637,  637,  637,  637,  638,  639,  640,  641,  642,    1,    1,    1,
+   643,  643,  643,  643,  643,  643,  643,  643,    1,    1,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1,  644,  644,  644,  644,  644,  644,  644,  644,
+   645,  645,  645,  645,  645,  645,  645,  645,  646,  647,  648,  649,    1,    1,    1,    1,
+   650,  650,  650,  650,  650,  650,  650,  650,    1,    1,    1,    1,    1,    1,    1,    1,
+   651,  651,  651,  651,  651,  651,  651,  651,  652,  652,  652,  652,  652,  652,  652,  653,
+   654,  654,  654,  654,  654,  654,  654,  655,  656,  656,  656,  656,  656,  656,  656,  656,
+   657,  657,  657,  657,  657,  657,  657,  657,  658,  659,    1,    1,    1,    1,    1,    1,
+   660,  660,  660,  660,  660,  660,  660,  660,    1,    1,    1,    1,    1,    1,    1,    1,
+   661,  661,  661,  661,  661,  661,  661,  661,  662,  662,  662,  662,  662,  662,  662,  662,
+   663,  663,  663,  663,  663,  663,  663,  663,  664,  664,  664,  664,  664,  664,  664,  664,
+   665,  665,  665,  665,  665,  665,  665,  665,  666,  667,    1,    1,    1,    1,    1,    1,
+   668,  668,  668,  668,  668,  668,  668,  668,    1,    1,    1,    1,    1,    1,    1,    1,
+   669,  669,  669,  669,  669,  669,  669,  669,  670,  670,  670,  670,  670,  670,  670,  670,
+   671,  671,  671,  671,  671,  671,  671,  671,  672,  672,  672,  672,  672,  672,  672,  672,
+   673,  673,  673,  673,  673,  673,  673,  673,  674,  675,    1,    1,    1,    1,    1,    1,
+   676,  676,  676,  676,  676,  676,  676,  676,    1,    1,    1,    1,    1,    1,    1,    1,
+   677,  677,  677,  677,  677,  677,  677,  677,  678,  678,  678,  678,  678,  678,  678,  679,
+   680,  680,  680,  680,  680,  680,  680,  681,  682,  682,  682,  682,  682,  682,  682,  682,
+   683,  683,  683,  683,  683,  683,  683,  683,  684,  685,    1,    1,    1,    1,    1,    1,
+   686,  686,  686,  686,  686,  686,  686,  686,    1,    1,    1,    1,    1,    1,    1,    1,
+   687,  687,  687,  687,  687,  687,  687,  687,  688,  688,  688,  688,  688,  688,  688,  688,
+   689,  689,  689,  689,  689,  689,  689,  689,  690,  690,  690,  690,  690,  690,  690,  690,
+   691,  691,  691,  691,  691,  691,  691,  691,  692,  693,    1,    1,    1,    1,    1,    1,
+   694,  694,  694,  694,  694,  694,  694,  694,    1,    1,    1,    1,    1,    1,    1,    1,
+   695,  695,  695,  695,  695,  695,  695,  695,  696,  696,  696,  696,  696,  696,  696,  696,
+   697,  697,  697,  697,  697,  697,  697,  697,  698,  698,  698,  698,  698,  698,  698,  698,
+   699,  699,  699,  699,  699,  699,  699,  699,  700,  701,    1,    1,    1,    1,    1,    1,
+   702,  702,  702,  702,  702,  702,  702,  702,    1,    1,    1,    1,    1,    1,    1,    1,
+   703,  703,  703,  703,  703,  703,  703,  703,  704,  704,  704,  704,  704,  704,  704,  704,
+   705,  705,  705,  705,  705,  705,  705,  705,  706,  706,  706,  706,  706,  706,  706,  706,
+   707,  707,  707,  707,  707,  707,  707,  707,  708,  709,  710,  711,  712,    1,    1,    1,
+   713,  713,  713,  713,  713,  713,  713,  713,    1,    1,    1,    1,    1,    1,    1,    1,
+   714,  714,  714,  714,  714,  714,  714,  714,  715,  715,  715,  715,  715,  715,  715,  716,
+   717,  717,  717,  717,  717,  717,  717,  718,  719,  719,  719,  719,  719,  719,  719,  719,
+   720,  720,  720,  720,  720,  720,  720,  720,  721,  722,    1,    1,    1,    1,    1,    1,
+   723,  723,  723,  723,  723,  723,  723,  723,    1,    1,    1,    1,    1,    1,    1,    1,
+   724,  724,  724,  724,  724,  724,  724,  724,  725,  725,  725,  725,  725,  725,  725,  725,
+   726,  726,  726,  726,  726,  726,  726,  726,  727,  727,  727,  727,  727,  727,  727,  727,
+   728,  728,  728,  728,  728,  728,  728,  728,  729,  730,    1,    1,    1,    1,    1,    1,
+   731,  731,  731,  731,  731,  731,  731,  731,    1,    1,    1,    1,    1,    1,    1,    1,
+   732,  732,  732,  732,  732,  732,  732,  732,  733,  733,  733,  733,  733,  733,  733,  733,
+   734,  734,  734,  734,  734,  734,  734,  734,  735,  735,  735,  735,  735,  735,  735,  735,
+   736,  736,  736,  736,  736,  736,  736,  736,  737,  738,    1,    1,    1,    1,    1,    1,
+   739,  739,  739,  739,  739,  739,  739,  739,    1,    1,    1,    1,    1,    1,    1,    1,
+   740,  740,  740,  740,  740,  740,  740,  740,  741,  741,  741,  741,  741,  741,  741,  741,
+   742,  742,  742,  742,  742,  742,  742,  742,  743,  743,  743,  743,  743,  743,  743,  743,
+   744,  744,  744,  744,  744,  744,  744,  744,  745,  746,  747,  748,  749,    1,    1,    1,
+   750,  750,  750,  750,  750,  750,  750,  750,    1,    1,    1,    1,    1,    1,    1,    1,
+   751,  751,  751,  751,  751,  751,  751,  751,  752,  752,  752,  752,  752,  752,  752,  753,
+   754,  754,  754,  754,  754,  754,  754,  755,  756,  756,  756,  756,  756,  756,  756,  756,
+   757,  757,  757,  757,  757,  757,  757,  757,  758,  759,    1,    1,    1,    1,    1,    1,
+   760,  760,  760,  760,  760,  760,  760,  760,    1,    1,    1,    1,    1,    1,    1,    1,
+   761,  761,  761,  761,  761,  761,  761,  761,    1,    1,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1,  762,  762,  762,  762,  762,  762,  762,  762,
+   763,  763,  763,  763,  763,  763,  763,  763,  764,  765,  766,  767,    1,    1,    1,    1,
+   768,  768,  768,  768,  768,  768,  768,  768,    1,    1,    1,    1,    1,    1,    1,    1,
+   769,  769,  769,  769,  769,  769,  769,  769,    1,    1,    1,    1,    1,    1,    1,    1,
+   770,  770,  770,  770,  770,  770,  770,  770,  771,  771,  771,  771,  771,  771,  771,  771,
+   772,  772,  772,  772,  772,  772,  772,  772,  773,  774,    1,    1,    1,    1,    1,    1,
+   775,  775,  775,  775,  775,  775,  775,  775,    1,    1,    1,    1,    1,    1,    1,    1,
+   776,  776,  776,  776,  776,  776,  776,  776,    1,    1,    1,    1,    1,    1,    1,    1,
+   777,  777,  777,  777,  777,  777,  777,  777,  778,  778,  778,  778,  778,  778,  778,  778,
+   779,  779,  779,  779,  779,  779,  779,  779,  780,  781,    1,    1,    1,    1,    1,    1,
+   782,  782,  782,  782,  782,  782,  782,  782,    1,    1,    1,    1,    1,    1,    1,    1,
+   783,  783,  783,  783,  783,  783,  783,  783,  784,  784,  784,  784,  784,  784,  784,  785,
+   786,  786,  786,  786,  786,  786,  786,  787,  788,  788,  788,  788,  788,  788,  788,  788,
+   789,  789,  789,  789,  789,  789,  789,  789,  790,  791,    1,    1,    1,    1,    1,    1,
+   792,  792,  792,  792,  792,  792,  792,  792,    1,    1,    1,    1,    1,    1,    1,    1,
+   793,  793,  793,  793,  793,  793,  793,  793,  794,  794,  794,  794,  794,  794,  794,  794,
+   795,  795,  795,  795,  795,  795,  795,  795,  796,  796,  796,  796,  796,  796,  796,  796,
+   797,  797,  797,  797,  797,  797,  797,  797,  798,  799,    1,    1,    1,    1,    1,    1,
+   800,  800,  800,  800,  800,  800,  800,  800,    1,    1,    1,    1,    1,    1,    1,    1,
+   801,  801,  801,  801,  801,  801,  801,  801,  802,  802,  802,  802,  802,  802,  802,  802,
+   803,  803,  803,  803,  803,  803,  803,  803,  804,  804,  804,  804,  804,  804,  804,  804,
+   805,  805,  805,  805,  805,  805,  805,  805,  806,  807,    1,    1,    1,    1,    1,    1,
+   808,  808,  808,  808,  808,  808,  808,  808,    1,    1,    1,    1,    1,    1,    1,    1,
+   809,  809,  809,  809,  809,  809,  809,  809,  810,  810,  810,  810,  810,  810,  810,  811,
+   812,  812,  812,  812,  812,  812,  812,  813,  814,  814,  814,  814,  814,  814,  814,  814,
+   815,  815,  815,  815,  815,  815,  815,  815,  816,  817,    1,    1,    1,    1,    1,    1,
+   818,  818,  818,  818,  818,  818,  818,  818,  819,  819,  819,  819,  819,  819,  819,  819,
+     1,    1,    1,    1,    1,    1,    1,    1,  820,  820,  820,  820,  820,  820,  820,  820,
+   821,  821,  821,  821,  821,  821,  821,  821,  822,  823,  824,  825,    1,    1,    1,    1,
+   826,  826,  826,  826,  826,  826,  826,  826,  827,  827,  827,  827,  827,  827,  827,  827,
+     1,    1,    1,    1,    1,    1,    1,    1,  828,  828,  828,  828,  828,  828,  828,  828,
+   829,  829,  829,  829,  829,  829,  829,  829,  830,  831,  832,  833,    1,    1,    1,    1,
+   834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,  834,
+   835,  835,  835,  835,  835,  835,  835,  836,  837,  837,  837,  837,  837,  837,  837,  838,
+   839,  839,  839,  839,  839,  839,  839,  839,  840,  840,  840,  840,  840,  840,  840,  840,
+   841,  842,  843,  844,    1,  845,  846,  847,    1,    1,    1,    1,    1,    1,    1,    1,
+   848,  848,  848,  848,  848,  848,  848,  848,    1,    1,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1,  849,  849,  849,  849,  849,  849,  849,  849,
+   850,  850,  850,  850,  850,  850,  850,  850,  851,  852,  853,  854,    1,    1,    1,    1,
+   855,  855,  855,  855,  855,  855,  855,  855,    1,    1,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1,  856,  856,  856,  856,  856,  856,  856,  856,
+   857,  857,  857,  857,  857,  857,  857,  857,  858,  859,  860,  861,    1,    1,    1,    1,
+   862,  862,  862,  862,  862,  862,  862,  862,    1,    1,    1,    1,    1,    1,    1,    1,
+   863,  863,  863,  863,  863,  863,  863,  863,  864,  864,  864,  864,  864,  864,  864,  865,
+   866,  866,  866,  866,  866,  866,  866,  867,  868,  868,  868,  868,  868,  868,  868,  868,
+   869,  869,  869,  869,  869,  869,  869,  869,  870,  871,    1,    1,    1,    1,    1,    1,
+   872,  872,  872,  872,  872,  872,  872,  872,  873,  873,  873,  873,  873,  873,  873,  873,
+   874,  874,  874,  874,  874,  874,  874,  874,  875,  875,  875,  875,  875,  875,  875,  875,
+   876,  876,  876,  876,  876,  876,  876,  876,  877,  877,  877,  877,  877,  877,  877,  877,
+   878,  878,  878,  878,  878,  878,  878,  878,  879,  880,    1,    1,    1,    1,    1,    1,
+   881,  881,  881,  881,  881,  881,  881,  881,  882,  882,  882,  882,  882,  882,  882,  882,
+   883,  883,  883,  883,  883,  883,  883,  883,  884,  884,  884,  884,  884,  884,  884,  884,
+   885,  885,  885,  885,  885,  885,  885,  885,  886,  886,  886,  886,  886,  886,  886,  886,
+   887,  887,  887,  887,  887,  887,  887,  887,  888,  889,    1,    1,    1,    1,    1,    1,
+   890,  890,  890,  890,  890,  890,  890,  890,  891,  891,  891,  891,  891,  891,  891,  891,
+   892,  892,  892,  892,  892,  892,  892,  892,  893,  893,  893,  893,  893,  893,  893,  894,
+   895,  895,  895,  895,  895,  895,  895,  896,  897,  897,  897,  897,  897,  897,  897,  897,
+   898,  898,  898,  898,  898,  898,  898,  898,  899,  900,    1,    1,    1,    1,    1,    1,
+   901,  901,  901,  901,  901,  901,  901,  901,    1,    1,    1,    1,    1,    1,    1,    1,
+   902,  902,  902,  902,  902,  902,  902,  902,  903,  903,  903,  903,  903,  903,  903,  904,
+   905,  905,  905,  905,  905,  905,  905,  906,  907,  907,  907,  907,  907,  907,  907,  907,
+   908,  908,  908,  908,  908,  908,  908,  908,  909,  910,    1,    1,    1,    1,    1,    1,
+   911,  911,  911,  911,  911,  911,  911,  911,  912,  912,  912,  912,  912,  912,  912,  912,
+   913,  913,  913,  913,  913,  913,  913,  913,  914,  914,  914,  914,  914,  914,  914,  914,
+   915,  915,  915,  915,  915,  915,  915,  915,  916,  916,  916,  916,  916,  916,  916,  916,
+   917,  917,  917,  917,  917,  917,  917,  917,  918,  919,    1,    1,    1,    1,    1,    1,
+   920,  920,  920,  920,  920,  920,  920,  920,  921,  921,  921,  921,  921,  921,  921,  921,
+   922,  922,  922,  922,  922,  922,  922,  922,  923,  923,  923,  923,  923,  923,  923,  923,
+   924,  924,  924,  924,  924,  924,  924,  924,  925,  925,  925,  925,  925,  925,  925,  925,
+   926,  926,  926,  926,  926,  926,  926,  926,  927,  928,    1,    1,    1,    1,    1,    1,
+   929,  929,  929,  929,  929,  929,  929,  929,  930,  930,  930,  930,  930,  930,  930,  930,
+   931,  931,  931,  931,  931,  931,  931,  931,  932,  932,  932,  932,  932,  932,  932,  933,
+   934,  934,  934,  934,  934,  934,  934,  935,  936,  936,  936,  936,  936,  936,  936,  936,
+   937,  937,  937,  937,  937,  937,  937,  937,  938,  939,    1,    1,    1,    1,    1,    1,
+   940,  940,  940,  940,  940,  940,  940,  940,  941,  941,  941,  941,  941,  941,  941,  941,
+   942,  942,  942,  942,  942,  942,  942,  942,  943,  943,  943,  943,  943,  943,  943,  944,
+   945,  945,  945,  945,  945,  945,  945,  946,  947,  947,  947,  947,  947,  947,  947,  947,
+   948,  948,  948,  948,  948,  948,  948,  948,  949,  950,    1,    1,    1,    1,    1,    1,
+   951,  951,  951,  951,  951,  951,  951,  951,  952,  952,  952,  952,  952,  952,  952,  952,
+   953,  953,  953,  953,  953,  953,  953,  953,  954,  954,  954,  954,  954,  954,  954,  955,
+   956,  956,  956,  956,  956,  956,  956,  957,  958,  958,  958,  958,  958,  958,  958,  958,
+   959,  959,  959,  959,  959,  959,  959,  959,  960,  961,    1,    1,    1,    1,    1,    1,
+   962,  962,  962,  962,  962,  962,  962,  962,  963,  963,  963,  963,  963,  963,  963,  963,
+   964,  964,  964,  964,  964,  964,  964,  964,  965,  965,  965,  965,  965,  965,  965,  966,
+   967,  967,  967,  967,  967,  967,  967,  968,  969,  969,  969,  969,  969,  969,  969,  969,
+   970,  970,  970,  970,  970,  970,  970,  970,  971,  972,    1,    1,    1,    1,    1,    1,
+   973,  973,  973,  973,  973,  973,  973,  973,  974,  974,  974,  974,  974,  974,  974,  974,
+   975,  975,  975,  975,  975,  975,  975,  975,  976,  976,  976,  976,  976,  976,  976,  977,
+   978,  978,  978,  978,  978,  978,  978,  979,  980,  980,  980,  980,  980,  980,  980,  980,
+   981,  981,  981,  981,  981,  981,  981,  981,  982,  983,    1,    1,    1,    1,    1,    1,
+   984,  984,  984,  984,  984,  984,  984,  984,  985,  985,  985,  985,  985,  985,  985,  985,
+   986,  986,  986,  986,  986,  986,  986,  986,  987,  987,  987,  987,  987,  987,  987,  988,
+   989,  989,  989,  989,  989,  989,  989,  990,  991,  991,  991,  991,  991,  991,  991,  991,
+   992,  992,  992,  992,  992,  992,  992,  992,  993,  994,    1,    1,    1,    1,    1,    1,
+   995,  995,  995,  995,  995,  995,  995,  995,  996,  996,  996,  996,  996,  996,  996,  996,
+   997,  997,  997,  997,  997,  997,  997,  997,  998,  998,  998,  998,  998,  998,  998,  999,
+  1000, 1000, 1000, 1000, 1000, 1000, 1000, 1001, 1002, 1002, 1002, 1002, 1002, 1002, 1002, 1002,
+  1003, 1003, 1003, 1003, 1003, 1003, 1003, 1003, 1004, 1005,    1,    1,    1,    1,    1,    1,
+  1006, 1006, 1006, 1006, 1006, 1006, 1006, 1006, 1007, 1007, 1007, 1007, 1007, 1007, 1007, 1007,
+  1008, 1008, 1008, 1008, 1008, 1008, 1008, 1008, 1009, 1009, 1009, 1009, 1009, 1009, 1009, 1010,
+  1011, 1011, 1011, 1011, 1011, 1011, 1011, 1012, 1013, 1013, 1013, 1013, 1013, 1013, 1013, 1013,
+  1014, 1014, 1014, 1014, 1014, 1014, 1014, 1014, 1015, 1016,    1,    1,    1,    1,    1,    1,
+  1017, 1017, 1017, 1017, 1017, 1017, 1017, 1017, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018,
+  1019, 1019, 1019, 1019, 1019, 1019, 1019, 1019, 1020, 1020, 1020, 1020, 1020, 1020, 1020, 1021,
+  1022, 1022, 1022, 1022, 1022, 1022, 1022, 1023, 1024, 1024, 1024, 1024, 1024, 1024, 1024, 1024,
+  1025, 1025, 1025, 1025, 1025, 1025, 1025, 1025, 1026, 1027,    1,    1,    1,    1,    1,    1,
+  1028, 1028, 1028, 1028, 1028, 1028, 1028, 1028, 1029, 1029, 1029, 1029, 1029, 1029, 1029, 1029,
+  1030, 1030, 1030, 1030, 1030, 1030, 1030, 1030, 1031, 1031, 1031, 1031, 1031, 1031, 1031, 1032,
+  1033, 1033, 1033, 1033, 1033, 1033, 1033, 1034, 1035, 1035, 1035, 1035, 1035, 1035, 1035, 1035,
+  1036, 1036, 1036, 1036, 1036, 1036, 1036, 1036, 1037, 1038,    1,    1,    1,    1,    1,    1,
+  1039, 1039, 1039, 1039, 1039, 1039, 1039, 1039, 1040, 1040, 1040, 1040, 1040, 1040, 1040, 1040,
+  1041, 1041, 1041, 1041, 1041, 1041, 1041, 1041, 1042, 1042, 1042, 1042, 1042, 1042, 1042, 1043,
+  1044, 1044, 1044, 1044, 1044, 1044, 1044, 1045, 1046, 1046, 1046, 1046, 1046, 1046, 1046, 1046,
+  1047, 1047, 1047, 1047, 1047, 1047, 1047, 1047, 1048, 1049,    1,    1,    1,    1,    1,    1,
+  1050, 1050, 1050, 1050, 1050, 1050, 1050, 1050, 1051, 1051, 1051, 1051, 1051, 1051, 1051, 1051,
+  1052, 1052, 1052, 1052, 1052, 1052, 1052, 1052, 1053, 1053, 1053, 1053, 1053, 1053, 1053, 1054,
+  1055, 1055, 1055, 1055, 1055, 1055, 1055, 1056, 1057, 1057, 1057, 1057, 1057, 1057, 1057, 1057,
+  1058, 1058, 1058, 1058, 1058, 1058, 1058, 1058, 1059, 1060,    1,    1,    1,    1,    1,    1,
+  1061, 1061, 1061, 1061, 1061, 1061, 1061, 1061, 1062, 1062, 1062, 1062, 1062, 1062, 1062, 1062,
+  1063, 1063, 1063, 1063, 1063, 1063, 1063, 1063, 1064, 1064, 1064, 1064, 1064, 1064, 1064, 1065,
+  1066, 1066, 1066, 1066, 1066, 1066, 1066, 1067, 1068, 1068, 1068, 1068, 1068, 1068, 1068, 1068,
+  1069, 1069, 1069, 1069, 1069, 1069, 1069, 1069, 1070, 1071,    1,    1,    1,    1,    1,    1,
+  1072, 1072, 1072, 1072, 1072, 1072, 1072, 1072, 1073, 1073, 1073, 1073, 1073, 1073, 1073, 1073,
+  1074, 1074, 1074, 1074, 1074, 1074, 1074, 1074, 1075, 1075, 1075, 1075, 1075, 1075, 1075, 1076,
+  1077, 1077, 1077, 1077, 1077, 1077, 1077, 1078, 1079, 1079, 1079, 1079, 1079, 1079, 1079, 1079,
+  1080, 1080, 1080, 1080, 1080, 1080, 1080, 1080, 1081, 1082,    1,    1,    1,    1,    1,    1,
+  1083, 1083, 1083, 1083, 1083, 1083, 1083, 1083, 1084, 1084, 1084, 1084, 1084, 1084, 1084, 1084,
+  1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1086, 1086, 1086, 1086, 1086, 1086, 1087,
+  1088, 1088, 1088, 1088, 1088, 1088, 1088, 1089, 1090, 1090, 1090, 1090, 1090, 1090, 1090, 1090,
+  1091, 1091, 1091, 1091, 1091, 1091, 1091, 1091, 1092, 1093,    1,    1,    1,    1,    1,    1,
+  1094, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+  1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095,
+  1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1095, 1096,
+  1097, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+  1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098,
+  1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1098, 1099,
+  1100, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101,
+  1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101,
+  1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1101, 1102,
+  1103, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+  1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+  1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1105,
+  1106, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+  1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107,
+  1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1107, 1108,
+  1109, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+  1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110,
+  1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1110, 1111,
+  1112, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
+  1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113,
+  1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1113, 1114,
+  1115, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+  1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+  1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1117,
+  1118, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119,
+  1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119,
+  1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1119, 1120,
+  1121, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1123,
+  1124, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+  1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+  1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1126,
+  1127, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,
+  1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128,
+  1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1128, 1129,
+  1130, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+  1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131,
+  1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1131, 1132,
+  1133, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+  1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134,
+  1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1134, 1135,
+  1136, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
+  1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137,
+  1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1137, 1138,
+  1139, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+  1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140,
+  1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1140, 1141,
+  1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142, 1142,
+  1143, 1143, 1143, 1143, 1143, 1143, 1143, 1143,    1,    1,    1,    1,    1,    1,    1,    1,
+  1144, 1144, 1144, 1144, 1144, 1144, 1144, 1144, 1145, 1145, 1145, 1145, 1145, 1145, 1145, 1146,
+  1147, 1147, 1147, 1147, 1147, 1147, 1147, 1148, 1149, 1149, 1149, 1149, 1149, 1149, 1149, 1149,
+  1150, 1150, 1150, 1150, 1150, 1150, 1150, 1150, 1151, 1152, 1153, 1154, 1155,    1,    1,    1,
+  1156, 1156, 1156, 1156, 1156, 1156, 1156, 1156,    1,    1,    1,    1,    1,    1,    1,    1,
+  1157, 1157, 1157, 1157, 1157, 1157, 1157, 1157, 1158, 1158, 1158, 1158, 1158, 1158, 1158, 1158,
+  1159, 1159, 1159, 1159, 1159, 1159, 1159, 1159, 1160, 1160, 1160, 1160, 1160, 1160, 1160, 1160,
+  1161, 1161, 1161, 1161, 1161, 1161, 1161, 1161, 1162, 1163, 1164, 1165, 1166,    1,    1,    1,
+  1167, 1167, 1167, 1167, 1167, 1167, 1167, 1167,    1,    1,    1,    1,    1,    1,    1,    1,
+  1168, 1168, 1168, 1168, 1168, 1168, 1168, 1168, 1169, 1169, 1169, 1169, 1169, 1169, 1169, 1169,
+  1170, 1170, 1170, 1170, 1170, 1170, 1170, 1170, 1171, 1171, 1171, 1171, 1171, 1171, 1171, 1171,
+  1172, 1172, 1172, 1172, 1172, 1172, 1172, 1172, 1173, 1174, 1175, 1176, 1177,    1,    1,    1,
+  1178, 1178, 1178, 1178, 1178, 1178, 1178, 1178,    1,    1,    1,    1,    1,    1,    1,    1,
+  1179, 1179, 1179, 1179, 1179, 1179, 1179, 1179, 1180, 1180, 1180, 1180, 1180, 1180, 1180, 1180,
+  1181, 1181, 1181, 1181, 1181, 1181, 1181, 1181, 1182, 1182, 1182, 1182, 1182, 1182, 1182, 1182,
+  1183, 1183, 1183, 1183, 1183, 1183, 1183, 1183, 1184, 1185, 1186, 1187, 1188,    1,    1,    1,
+  1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1190, 1190, 1190, 1190, 1190, 1190, 1190, 1191,
+  1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1193, 1193, 1193, 1193, 1193, 1193, 1193, 1194,
+  1195, 1195, 1195, 1195, 1195, 1195, 1195, 1196, 1197, 1197, 1197, 1197, 1197, 1197, 1197, 1197,
+  1198, 1198, 1198, 1198, 1198, 1198, 1198, 1198, 1199, 1200,    1,    1,    1,    1,    1,    1,
+  1201, 1201, 1201, 1201, 1201, 1201, 1201, 1201, 1202, 1202, 1202, 1202, 1202, 1202, 1202, 1202,
+  1203, 1203, 1203, 1203, 1203, 1203, 1203, 1203, 1204, 1204, 1204, 1204, 1204, 1204, 1204, 1204,
+  1205, 1205, 1205, 1205, 1205, 1205, 1205, 1205, 1206, 1207,    1,    1,    1,    1,    1,    1,
+  1208, 1208, 1208, 1208, 1208, 1208, 1208, 1208, 1209, 1209, 1209, 1209, 1209, 1209, 1209, 1209,
+  1210, 1210, 1210, 1210, 1210, 1210, 1210, 1210, 1211, 1211, 1211, 1211, 1211, 1211, 1211, 1211,
+  1212, 1212, 1212, 1212, 1212, 1212, 1212, 1212, 1213, 1214,    1,    1,    1,    1,    1,    1,
+  1215, 1215, 1215, 1215, 1215, 1215, 1215, 1215,    1,    1,    1,    1,    1,    1,    1,    1,
+  1216, 1216, 1216, 1216, 1216, 1216, 1216, 1216, 1217, 1217, 1217, 1217, 1217, 1217, 1217, 1217,
+  1218, 1218, 1218, 1218, 1218, 1218, 1218, 1218, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+  1220, 1220, 1220, 1220, 1220, 1220, 1220, 1220, 1221, 1222, 1223, 1224, 1225,    1,    1,    1,
+  1189, 1189, 1189, 1189, 1189, 1189, 1189, 1189, 1226, 1226, 1226, 1226, 1226, 1226, 1226, 1227,
+  1228, 1228, 1228, 1228, 1228, 1228, 1228, 1228,    1,    1,    1,    1,    1,    1,    1,    1,
+  1229, 1229, 1229, 1229, 1229, 1229, 1229, 1229, 1230, 1230, 1230, 1230, 1230, 1230, 1230, 1231,
+  1232, 1232, 1232, 1232, 1232, 1232, 1232, 1233, 1234, 1234, 1234, 1234, 1234, 1234, 1234, 1234,
+  1235, 1235, 1235, 1235, 1235, 1235, 1235, 1235, 1236, 1237, 1238, 1239, 1240,    1,    1,    1,
+  1241, 1241, 1241, 1241, 1241, 1241, 1241, 1241, 1242, 1242, 1242, 1242, 1242, 1242, 1242, 1242,
+  1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1244, 1244, 1244, 1244, 1244, 1244, 1244, 1244,
+  1245, 1245, 1245, 1245, 1245, 1245, 1245, 1245, 1246, 1246, 1246, 1246, 1246, 1246, 1246, 1246,
+  1247, 1247, 1247, 1247, 1247, 1247, 1247, 1247, 1248, 1249, 1250, 1251, 1252,    1,    1,    1,
+  1253, 1253, 1253, 1253, 1253, 1253, 1253, 1253, 1254, 1254, 1254, 1254, 1254, 1254, 1254, 1254,
+  1255, 1255, 1255, 1255, 1255, 1255, 1255, 1255, 1256, 1256, 1256, 1256, 1256, 1256, 1256, 1256,
+  1257, 1257, 1257, 1257, 1257, 1257, 1257, 1257, 1258, 1258, 1258, 1258, 1258, 1258, 1258, 1258,
+  1259, 1259, 1259, 1259, 1259, 1259, 1259, 1259, 1260, 1261, 1262, 1263, 1264,    1,    1,    1,
+  1265, 1265, 1265, 1265, 1265, 1265, 1265, 1265, 1266, 1266, 1266, 1266, 1266, 1266, 1266, 1266,
+  1267, 1267, 1267, 1267, 1267, 1267, 1267, 1267, 1268, 1268, 1268, 1268, 1268, 1268, 1268, 1268,
+  1269, 1269, 1269, 1269, 1269, 1269, 1269, 1269, 1270, 1270, 1270, 1270, 1270, 1270, 1270, 1270,
+  1271, 1271, 1271, 1271, 1271, 1271, 1271, 1271, 1272, 1273, 1274, 1275, 1276,    1,    1,    1,
+  1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1278, 1278, 1278, 1278, 1278, 1278, 1278, 1279,
+  1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1281, 1281, 1281, 1281, 1281, 1281, 1281, 1282,
+  1283, 1283, 1283, 1283, 1283, 1283, 1283, 1284, 1285, 1285, 1285, 1285, 1285, 1285, 1285, 1285,
+  1286, 1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288,    1,    1,    1,    1,    1,    1,
+  1289, 1289, 1289, 1289, 1289, 1289, 1289, 1289, 1290, 1290, 1290, 1290, 1290, 1290, 1290, 1290,
+  1291, 1291, 1291, 1291, 1291, 1291, 1291, 1291, 1292, 1292, 1292, 1292, 1292, 1292, 1292, 1292,
+  1293, 1293, 1293, 1293, 1293, 1293, 1293, 1293, 1294, 1294, 1294, 1294, 1294, 1294, 1294, 1294,
+  1295, 1295, 1295, 1295, 1295, 1295, 1295, 1295, 1296, 1297,    1,    1,    1,    1,    1,    1,
+  1298, 1298, 1298, 1298, 1298, 1298, 1298, 1298, 1299, 1299, 1299, 1299, 1299, 1299, 1299, 1299,
+  1300, 1300, 1300, 1300, 1300, 1300, 1300, 1300, 1301, 1301, 1301, 1301, 1301, 1301, 1301, 1301,
+  1302, 1302, 1302, 1302, 1302, 1302, 1302, 1302, 1303, 1303, 1303, 1303, 1303, 1303, 1303, 1303,
+  1304, 1304, 1304, 1304, 1304, 1304, 1304, 1304, 1305, 1306,    1,    1,    1,    1,    1,    1,
+  1307, 1307, 1307, 1307, 1307, 1307, 1307, 1307, 1308, 1308, 1308, 1308, 1308, 1308, 1308, 1308,
+  1309, 1309, 1309, 1309, 1309, 1309, 1309, 1309, 1310, 1310, 1310, 1310, 1310, 1310, 1310, 1310,
+  1311, 1311, 1311, 1311, 1311, 1311, 1311, 1311, 1312, 1312, 1312, 1312, 1312, 1312, 1312, 1312,
+  1313, 1313, 1313, 1313, 1313, 1313, 1313, 1313, 1314, 1315, 1316, 1317, 1318,    1,    1,    1,
+  1277, 1277, 1277, 1277, 1277, 1277, 1277, 1277, 1319, 1319, 1319, 1319, 1319, 1319, 1319, 1320,
+  1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321, 1321,
+  1322, 1322, 1322, 1322, 1322, 1322, 1322, 1322,    1,    1,    1,    1,    1,    1,    1,    1,
+  1323, 1323, 1323, 1323, 1323, 1323, 1323, 1323, 1324, 1324, 1324, 1324, 1324, 1324, 1324, 1325,
+  1326, 1326, 1326, 1326, 1326, 1326, 1326, 1327, 1328, 1328, 1328, 1328, 1328, 1328, 1328, 1328,
+  1329, 1329, 1329, 1329, 1329, 1329, 1329, 1329, 1330, 1331, 1332, 1333, 1334,    1,    1,    1,
+  1335, 1335, 1335, 1335, 1335, 1335, 1335, 1335, 1336, 1336, 1336, 1336, 1336, 1336, 1336, 1336,
+  1337, 1337, 1337, 1337, 1337, 1337, 1337, 1337, 1338, 1338, 1338, 1338, 1338, 1338, 1338, 1338,
+  1339, 1339, 1339, 1339, 1339, 1339, 1339, 1339, 1340, 1340, 1340, 1340, 1340, 1340, 1340, 1340,
+  1341, 1341, 1341, 1341, 1341, 1341, 1341, 1341, 1342, 1343, 1344, 1345, 1346,    1,    1,    1,
+  1347, 1347, 1347, 1347, 1347, 1347, 1347, 1347, 1348, 1348, 1348, 1348, 1348, 1348, 1348, 1348,
+  1349, 1349, 1349, 1349, 1349, 1349, 1349, 1349, 1350, 1350, 1350, 1350, 1350, 1350, 1350, 1350,
+  1351, 1351, 1351, 1351, 1351, 1351, 1351, 1351, 1352, 1352, 1352, 1352, 1352, 1352, 1352, 1352,
+  1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1354, 1355, 1356, 1357, 1358,    1,    1,    1,
+  1359, 1359, 1359, 1359, 1359, 1359, 1359, 1359, 1360, 1360, 1360, 1360, 1360, 1360, 1360, 1360,
+  1361, 1361, 1361, 1361, 1361, 1361, 1361, 1361, 1362, 1362, 1362, 1362, 1362, 1362, 1362, 1362,
+  1363, 1363, 1363, 1363, 1363, 1363, 1363, 1363, 1364, 1364, 1364, 1364, 1364, 1364, 1364, 1364,
+  1365, 1365, 1365, 1365, 1365, 1365, 1365, 1365, 1366, 1367, 1368, 1369, 1370,    1,    1,    1,
+  1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1372, 1372, 1372, 1372, 1372, 1372, 1372, 1373,
+  1374, 1374, 1374, 1374, 1374, 1374, 1374, 1374, 1375, 1375, 1375, 1375, 1375, 1375, 1375, 1376,
+  1377, 1377, 1377, 1377, 1377, 1377, 1377, 1378, 1379, 1379, 1379, 1379, 1379, 1379, 1379, 1379,
+  1380, 1380, 1380, 1380, 1380, 1380, 1380, 1380, 1381, 1382,    1,    1,    1,    1,    1,    1,
+  1383, 1383, 1383, 1383, 1383, 1383, 1383, 1383, 1384, 1384, 1384, 1384, 1384, 1384, 1384, 1384,
+  1385, 1385, 1385, 1385, 1385, 1385, 1385, 1385, 1386, 1386, 1386, 1386, 1386, 1386, 1386, 1386,
+  1387, 1387, 1387, 1387, 1387, 1387, 1387, 1387, 1388, 1388, 1388, 1388, 1388, 1388, 1388, 1388,
+  1389, 1389, 1389, 1389, 1389, 1389, 1389, 1389, 1390, 1391,    1,    1,    1,    1,    1,    1,
+  1392, 1392, 1392, 1392, 1392, 1392, 1392, 1392, 1393, 1393, 1393, 1393, 1393, 1393, 1393, 1393,
+  1394, 1394, 1394, 1394, 1394, 1394, 1394, 1394, 1395, 1395, 1395, 1395, 1395, 1395, 1395, 1395,
+  1396, 1396, 1396, 1396, 1396, 1396, 1396, 1396, 1397, 1397, 1397, 1397, 1397, 1397, 1397, 1397,
+  1398, 1398, 1398, 1398, 1398, 1398, 1398, 1398, 1399, 1400,    1,    1,    1,    1,    1,    1,
+  1401, 1401, 1401, 1401, 1401, 1401, 1401, 1401, 1402, 1402, 1402, 1402, 1402, 1402, 1402, 1402,
+  1403, 1403, 1403, 1403, 1403, 1403, 1403, 1403, 1404, 1404, 1404, 1404, 1404, 1404, 1404, 1404,
+  1405, 1405, 1405, 1405, 1405, 1405, 1405, 1405, 1406, 1406, 1406, 1406, 1406, 1406, 1406, 1406,
+  1407, 1407, 1407, 1407, 1407, 1407, 1407, 1407, 1408, 1409, 1410, 1411, 1412,    1,    1,    1,
+  1371, 1371, 1371, 1371, 1371, 1371, 1371, 1371, 1413, 1413, 1413, 1413, 1413, 1413, 1413, 1414,
+  1415, 1415, 1415, 1415, 1415, 1415, 1415, 1415,    1,    1,    1,    1,    1,    1,    1,    1,
+  1416, 1416, 1416, 1416, 1416, 1416, 1416, 1416, 1417, 1417, 1417, 1417, 1417, 1417, 1417, 1418,
+  1419, 1419, 1419, 1419, 1419, 1419, 1419, 1420, 1421, 1421, 1421, 1421, 1421, 1421, 1421, 1421,
+  1422, 1422, 1422, 1422, 1422, 1422, 1422, 1422, 1423, 1424, 1425, 1426, 1427,    1,    1,    1,
+  1428, 1428, 1428, 1428, 1428, 1428, 1428, 1428,    1,    1,    1,    1,    1,    1,    1,    1,
+  1429, 1429, 1429, 1429, 1429, 1429, 1429, 1429, 1430, 1430, 1430, 1430, 1430, 1430, 1430, 1430,
+  1431, 1431, 1431, 1431, 1431, 1431, 1431, 1431, 1432, 1432, 1432, 1432, 1432, 1432, 1432, 1432,
+  1433, 1433, 1433, 1433, 1433, 1433, 1433, 1433, 1434, 1435, 1436, 1437, 1438,    1,    1,    1,
+  1439, 1439, 1439, 1439, 1439, 1439, 1439, 1439,    1,    1,    1,    1,    1,    1,    1,    1,
+  1440, 1440, 1440, 1440, 1440, 1440, 1440, 1440, 1441, 1441, 1441, 1441, 1441, 1441, 1441, 1441,
+  1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1443, 1443, 1443, 1443, 1443, 1443, 1443, 1443,
+  1444, 1444, 1444, 1444, 1444, 1444, 1444, 1444, 1445, 1446, 1447, 1448, 1449,    1,    1,    1,
+  1450, 1450, 1450, 1450, 1450, 1450, 1450, 1450,    1,    1,    1,    1,    1,    1,    1,    1,
+  1451, 1451, 1451, 1451, 1451, 1451, 1451, 1451, 1452, 1452, 1452, 1452, 1452, 1452, 1452, 1452,
+  1453, 1453, 1453, 1453, 1453, 1453, 1453, 1453, 1454, 1454, 1454, 1454, 1454, 1454, 1454, 1454,
+  1455, 1455, 1455, 1455, 1455, 1455, 1455, 1455, 1456, 1457, 1458, 1459, 1460,    1,    1,    1,
+  1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1462, 1462, 1462, 1462, 1462, 1462, 1462, 1463,
+  1464, 1464, 1464, 1464, 1464, 1464, 1464, 1464, 1465, 1465, 1465, 1465, 1465, 1465, 1465, 1466,
+  1467, 1467, 1467, 1467, 1467, 1467, 1467, 1468, 1469, 1469, 1469, 1469, 1469, 1469, 1469, 1469,
+  1470, 1470, 1470, 1470, 1470, 1470, 1470, 1470, 1471, 1472,    1,    1,    1,    1,    1,    1,
+  1473, 1473, 1473, 1473, 1473, 1473, 1473, 1473, 1474, 1474, 1474, 1474, 1474, 1474, 1474, 1474,
+  1475, 1475, 1475, 1475, 1475, 1475, 1475, 1475, 1476, 1476, 1476, 1476, 1476, 1476, 1476, 1476,
+  1477, 1477, 1477, 1477, 1477, 1477, 1477, 1477, 1478, 1478, 1478, 1478, 1478, 1478, 1478, 1478,
+  1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1480, 1481,    1,    1,    1,    1,    1,    1,
+     1,    1,    1,    1,    1,    1,    1,    1, 1482, 1482, 1482, 1482, 1482, 1482, 1482, 1482,
+  1483, 1483, 1483, 1483, 1483, 1483, 1483, 1483, 1484, 1484, 1484, 1484, 1484, 1484, 1484, 1484,
+  1485, 1485, 1485, 1485, 1485, 1485, 1485, 1485, 1486, 1486, 1486, 1486, 1486, 1486, 1486, 1486,
+  1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1488, 1489,    1,    1,    1,    1,    1,    1,
+  1490, 1490, 1490, 1490, 1490, 1490, 1490, 1490,    1,    1,    1,    1,    1,    1,    1,    1,
+  1491, 1491, 1491, 1491, 1491, 1491, 1491, 1491, 1492, 1492, 1492, 1492, 1492, 1492, 1492, 1492,
+  1493, 1493, 1493, 1493, 1493, 1493, 1493, 1493, 1494, 1494, 1494, 1494, 1494, 1494, 1494, 1494,
+  1495, 1495, 1495, 1495, 1495, 1495, 1495, 1495, 1496, 1497, 1498, 1499, 1500,    1,    1,    1,
+  1461, 1461, 1461, 1461, 1461, 1461, 1461, 1461, 1501, 1501, 1501, 1501, 1501, 1501, 1501, 1502,
+  1503, 1503, 1503, 1503, 1503, 1503, 1503, 1503,    1,    1,    1,    1,    1,    1,    1,    1,
+  1504, 1504, 1504, 1504, 1504, 1504, 1504, 1504, 1505, 1505, 1505, 1505, 1505, 1505, 1505, 1506,
+  1507, 1507, 1507, 1507, 1507, 1507, 1507, 1508, 1509, 1509, 1509, 1509, 1509, 1509, 1509, 1509,
+  1510, 1510, 1510, 1510, 1510, 1510, 1510, 1510, 1511, 1512, 1513, 1514, 1515,    1,    1,    1,
+  1516, 1516, 1516, 1516, 1516, 1516, 1516, 1516, 1517, 1517, 1517, 1517, 1517, 1517, 1517, 1517,
+  1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1519, 1519, 1519, 1519, 1519, 1519, 1519, 1519,
+  1520, 1520, 1520, 1520, 1520, 1520, 1520, 1520, 1521, 1521, 1521, 1521, 1521, 1521, 1521, 1521,
+  1522, 1522, 1522, 1522, 1522, 1522, 1522, 1522, 1523, 1524, 1525, 1526, 1527,    1,    1,    1,
+  1528, 1528, 1528, 1528, 1528, 1528, 1528, 1528, 1529, 1529, 1529, 1529, 1529, 1529, 1529, 1529,
+  1530, 1530, 1530, 1530, 1530, 1530, 1530, 1530, 1531, 1531, 1531, 1531, 1531, 1531, 1531, 1531,
+  1532, 1532, 1532, 1532, 1532, 1532, 1532, 1532, 1533, 1533, 1533, 1533, 1533, 1533, 1533, 1533,
+  1534, 1534, 1534, 1534, 1534, 1534, 1534, 1534, 1535, 1536, 1537, 1538, 1539,    1,    1,    1,
+  1540, 1540, 1540, 1540, 1540, 1540, 1540, 1540, 1541, 1541, 1541, 1541, 1541, 1541, 1541, 1541,
+  1542, 1542, 1542, 1542, 1542, 1542, 1542, 1542, 1543, 1543, 1543, 1543, 1543, 1543, 1543, 1543,
+  1544, 1544, 1544, 1544, 1544, 1544, 1544, 1544, 1545, 1545, 1545, 1545, 1545, 1545, 1545, 1545,
+  1546, 1546, 1546, 1546, 1546, 1546, 1546, 1546, 1547, 1548, 1549, 1550, 1551,    1,    1,    1,
+  1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1553, 1553, 1553, 1553, 1553, 1553, 1553, 1554,
+  1555, 1555, 1555, 1555, 1555, 1555, 1555, 1555, 1556, 1556, 1556, 1556, 1556, 1556, 1556, 1557,
+  1558, 1558, 1558, 1558, 1558, 1558, 1558, 1559, 1560, 1560, 1560, 1560, 1560, 1560, 1560, 1560,
+  1561, 1561, 1561, 1561, 1561, 1561, 1561, 1561, 1562, 1563,    1,    1,    1,    1,    1,    1,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1565, 1565, 1565, 1565, 1565, 1565, 1565, 1565,
+  1566, 1566, 1566, 1566, 1566, 1566, 1566, 1566, 1567, 1567, 1567, 1567, 1567, 1567, 1567, 1567,
+  1568, 1568, 1568, 1568, 1568, 1568, 1568, 1568, 1569, 1569, 1569, 1569, 1569, 1569, 1569, 1569,
+  1570, 1570, 1570, 1570, 1570, 1570, 1570, 1570, 1571, 1572,    1,    1,    1,    1,    1,    1,
+  1573, 1573, 1573, 1573, 1573, 1573, 1573, 1573, 1574, 1574, 1574, 1574, 1574, 1574, 1574, 1574,
+  1575, 1575, 1575, 1575, 1575, 1575, 1575, 1575, 1576, 1576, 1576, 1576, 1576, 1576, 1576, 1576,
+  1577, 1577, 1577, 1577, 1577, 1577, 1577, 1577, 1578, 1578, 1578, 1578, 1578, 1578, 1578, 1578,
+  1579, 1579, 1579, 1579, 1579, 1579, 1579, 1579, 1580, 1581,    1,    1,    1,    1,    1,    1,
+  1582, 1582, 1582, 1582, 1582, 1582, 1582, 1582, 1583, 1583, 1583, 1583, 1583, 1583, 1583, 1583,
+  1584, 1584, 1584, 1584, 1584, 1584, 1584, 1584, 1585, 1585, 1585, 1585, 1585, 1585, 1585, 1585,
+  1586, 1586, 1586, 1586, 1586, 1586, 1586, 1586, 1587, 1587, 1587, 1587, 1587, 1587, 1587, 1587,
+  1588, 1588, 1588, 1588, 1588, 1588, 1588, 1588, 1589, 1590, 1591, 1592, 1593,    1,    1,    1,
+  1552, 1552, 1552, 1552, 1552, 1552, 1552, 1552, 1594, 1594, 1594, 1594, 1594, 1594, 1594, 1595,
+  1596, 1596, 1596, 1596, 1596, 1596, 1596, 1596, 1597, 1597, 1597, 1597, 1597, 1597, 1597, 1597,
+  1598, 1598, 1598, 1598, 1598, 1598, 1598, 1598, 1599, 1599, 1599, 1599, 1599, 1599, 1599, 1599,
+  1600, 1600, 1600, 1600, 1600, 1600, 1600, 1600, 1601, 1601, 1601, 1601, 1601, 1601, 1601, 1601,
+  1602, 1602, 1602, 1602, 1602, 1602, 1602, 1602, 1603, 1603, 1603, 1603, 1603, 1603, 1603, 1603,
+  1604, 1604, 1604, 1604, 1604, 1604, 1604, 1604, 1605, 1605, 1605, 1605, 1605, 1605, 1605, 1605,
+  1606, 1606, 1606, 1606, 1606, 1606, 1606, 1606, 1607, 1607, 1607, 1607, 1607, 1607, 1607, 1607,
+  1608, 1608, 1608, 1608, 1608, 1608, 1608, 1608, 1609, 1609, 1609, 1609, 1609, 1609, 1609, 1609,
+  1610, 1610, 1610, 1610, 1610, 1610, 1610, 1610, 1611, 1611, 1611, 1611, 1611, 1611, 1611, 1611,
+  1612, 1612, 1612, 1612, 1612, 1612, 1612, 1612, 1613, 1613, 1613, 1613, 1613, 1613, 1613, 1613,
+  1614, 1614, 1614, 1614, 1614, 1614, 1614, 1614, 1615, 1615, 1615, 1615, 1615, 1615, 1615, 1615,
+  1616, 1616, 1616, 1616, 1616, 1616, 1616, 1616, 1617, 1617, 1617, 1617, 1617, 1617, 1617, 1617,
+  1618, 1618, 1618, 1618, 1618, 1618, 1618, 1618, 1619, 1619, 1619, 1619, 1619, 1619, 1619, 1619,
+  1620, 1620, 1620, 1620, 1620, 1620, 1620, 1620, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+  1622, 1622, 1622, 1622, 1622, 1622, 1622, 1622, 1623, 1623, 1623, 1623, 1623, 1623, 1623, 1623,
+  1624, 1624, 1624, 1624, 1624, 1624, 1624, 1624, 1625, 1626,    1,    1,    1,    1,    1,    1,
+  1627, 1627, 1627, 1627, 1627, 1627, 1627, 1627, 1628, 1628, 1628, 1628, 1628, 1628, 1628, 1628,
+  1629, 1629, 1629, 1629, 1629, 1629, 1629, 1629, 1630, 1630, 1630, 1630, 1630, 1630, 1630, 1630,
+  1631, 1631, 1631, 1631, 1631, 1631, 1631, 1631, 1632, 1632, 1632, 1632, 1632, 1632, 1632, 1632,
+  1633, 1633, 1633, 1633, 1633, 1633, 1633, 1633, 1634, 1634, 1634, 1634, 1634, 1634, 1634, 1634,
+  1635, 1635, 1635, 1635, 1635, 1635, 1635, 1635, 1636, 1636, 1636, 1636, 1636, 1636, 1636, 1636,
+  1637, 1637, 1637, 1637, 1637, 1637, 1637, 1637, 1638, 1638, 1638, 1638, 1638, 1638, 1638, 1638,
+  1639, 1639, 1639, 1639, 1639, 1639, 1639, 1639, 1640, 1640, 1640, 1640, 1640, 1640, 1640, 1640,
+  1641, 1641, 1641, 1641, 1641, 1641, 1641, 1641, 1642, 1642, 1642, 1642, 1642, 1642, 1642, 1642,
+  1643, 1643, 1643, 1643, 1643, 1643, 1643, 1643, 1644, 1644, 1644, 1644, 1644, 1644, 1644, 1644,
+  1645, 1645, 1645, 1645, 1645, 1645, 1645, 1645, 1646, 1646, 1646, 1646, 1646, 1646, 1646, 1646,
+  1647, 1647, 1647, 1647, 1647, 1647, 1647, 1647, 1648, 1648, 1648, 1648, 1648, 1648, 1648, 1648,
+  1649, 1649, 1649, 1649, 1649, 1649, 1649, 1649, 1650, 1650, 1650, 1650, 1650, 1650, 1650, 1650,
+  1651, 1651, 1651, 1651, 1651, 1651, 1651, 1651, 1652, 1652, 1652, 1652, 1652, 1652, 1652, 1652,
+  1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+  1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1656, 1657,    1,    1,    1,    1,    1,    1,
+  1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1659, 1659, 1659, 1659, 1659, 1659, 1659, 1659,
+  1660, 1660, 1660, 1660, 1660, 1660, 1660, 1660, 1661, 1661, 1661, 1661, 1661, 1661, 1661, 1661,
+  1662, 1662, 1662, 1662, 1662, 1662, 1662, 1662, 1663, 1664,    1,    1,    1,    1,    1,    1,
+  1665, 1665, 1665, 1665, 1665, 1665, 1665, 1665, 1666, 1666, 1666, 1666, 1666, 1666, 1666, 1666,
+  1667, 1667, 1667, 1667, 1667, 1667, 1667, 1667, 1668, 1668, 1668, 1668, 1668, 1668, 1668, 1668,
+  1669, 1669, 1669, 1669, 1669, 1669, 1669, 1669, 1670, 1671,    1,    1,    1,    1,    1,    1,
+  1672, 1672, 1672, 1672, 1672, 1672, 1672, 1672, 1673, 1673, 1673, 1673, 1673, 1673, 1673, 1673,
+  1674, 1674, 1674, 1674, 1674, 1674, 1674, 1674, 1675, 1675, 1675, 1675, 1675, 1675, 1675, 1675,
+  1676, 1676, 1676, 1676, 1676, 1676, 1676, 1676, 1677, 1678,    1,    1,    1,    1,    1,    1,
+  1679, 1679, 1679, 1679, 1679, 1679, 1679, 1679, 1680, 1680, 1680, 1680, 1680, 1680, 1680, 1680,
+  1681, 1681, 1681, 1681, 1681, 1681, 1681, 1681, 1682, 1682, 1682, 1682, 1682, 1682, 1682, 1682,
+  1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1684, 1685,    1,    1,    1,    1,    1,    1,
+  1686, 1686, 1686, 1686, 1686, 1686, 1686, 1686, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687,
+  1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1689, 1689, 1689, 1689, 1689, 1689, 1689, 1689,
+  1690, 1690, 1690, 1690, 1690, 1690, 1690, 1690, 1691, 1692,    1,    1,    1,    1,    1,    1,
+  1693, 1693, 1693, 1693, 1693, 1693, 1693, 1693, 1694, 1694, 1694, 1694, 1694, 1694, 1694, 1694,
+  1695, 1695, 1695, 1695, 1695, 1695, 1695, 1695, 1696, 1696, 1696, 1696, 1696, 1696, 1696, 1696,
+  1697, 1697, 1697, 1697, 1697, 1697, 1697, 1697, 1698, 1699,    1,    1,    1,    1,    1,    1,
+  1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700, 1700,
+};
+
+/* Opcode base cycles (indexed by page offset + instruction word bits 3-0) */
+const unsigned char m68ki_opcode_cycles[10912] =
+{
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 16, 16, 16, 16, 16, 16, 16, 16,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 24, 24, 24, 24, 24, 24, 24, 24,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  10, 10, 10, 10, 10, 10, 10, 10, 16, 16, 16, 16, 16, 16, 16, 16,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 24, 24, 24, 24, 24, 24, 24, 24,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36,  0,  0,  0,  0,  0,  0,
+  10, 10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24,  0,  0, 20,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22, 22,
+  24, 24, 24, 24, 24, 24, 24, 24, 22, 26, 22, 24, 18,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28, 24, 26, 20,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28, 24, 26, 20,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28, 24, 26, 20,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28, 24, 26, 20,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 28, 32, 28, 30, 24,  0,  0,  0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+  28, 28, 28, 28, 28, 28, 28, 28, 30, 30, 30, 30, 30, 30, 30, 30,
+  32, 32, 32, 32, 32, 32, 32, 32, 30, 34, 30, 32, 26,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 28, 32, 28, 30, 24,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28,
+  30, 30, 30, 30, 30, 30, 30, 30, 32, 32, 32, 32, 32, 32, 32, 32,
+  34, 34, 34, 34, 34, 34, 34, 34, 32, 36, 32, 34, 28,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22, 22,
+  24, 24, 24, 24, 24, 24, 24, 24, 22, 26, 22, 24, 18,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28, 24, 26, 20,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  10, 10, 10, 10, 10, 10, 10, 10,  0,  0,  0,  0,  0,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 14,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12,  8, 12,  8, 12,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 20, 24, 20, 22, 16,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16,
+  20, 20, 20, 20, 20, 20, 20, 20, 16, 20, 16, 20,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 22, 22, 22, 22, 22, 22, 22, 22,
+  24, 24, 24, 24, 24, 24, 24, 24, 22, 26,  0,  0,  4,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+   0,  0,  0,  0,  0,  0,  0,  0, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+  16, 16, 16, 16, 16, 16, 16, 16, 12, 12, 12, 12, 12, 12, 12, 12,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   0,  4,  4, 20,  0, 16,  4, 20,  0,  0,  0,  0,  0,  0,  0,  0,
+  16, 16, 16, 16, 16, 16, 16, 16,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 18, 18, 18, 18, 18, 18, 18, 18,
+  22, 22, 22, 22, 22, 22, 22, 22, 18, 20, 18, 22,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0, 10, 10, 10, 10, 10, 10, 10, 10,
+  14, 14, 14, 14, 14, 14, 14, 14, 10, 12, 10, 14,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18, 18,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   6,  6,  6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10,  8, 12,  8, 10,  4,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   6,  6,  6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10,  8, 12,  8, 10,  4,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 18, 18, 18, 18, 18, 18, 18, 18,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 30, 30, 30, 30, 30, 30, 30, 30,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 14,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+  10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+  12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 14, 18, 14, 16, 10,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 20, 20, 20, 20, 20, 20, 20, 20,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 14,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 12, 12, 12, 12, 12, 12, 12, 12,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  0,  0,  0,  0,  0,  0,  0,  0,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   6,  6,  6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10,  8, 12,  8, 10,  4,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  6,  6,  6,  6,  6,  6,  6,  6,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   6,  6,  6,  6,  6,  6,  6,  6,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10,  8, 12,  8, 10,  4,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6, 18, 18, 18, 18, 18, 18, 18, 18,
+   4,  4,  4,  4,  4,  4,  4,  4,  0,  0,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  10, 10, 10, 10, 10, 10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 12, 16, 12, 14,  8,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20, 16, 18, 12,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8, 30, 30, 30, 30, 30, 30, 30, 30,
+  20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20, 20,
+  22, 22, 22, 22, 22, 22, 22, 22, 24, 24, 24, 24, 24, 24, 24, 24,
+  26, 26, 26, 26, 26, 26, 26, 26, 24, 28,  0,  0,  0,  0,  0,  0,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14,
+  16, 16, 16, 16, 16, 16, 16, 16, 18, 18, 18, 18, 18, 18, 18, 18,
+  20, 20, 20, 20, 20, 20, 20, 20, 18, 22, 18, 20, 16,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4, 18, 18, 18, 18, 18, 18, 18, 18,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,  6,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+   8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,  8,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+  12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+  14, 14, 14, 14, 14, 14, 14, 14, 16, 16, 16, 16, 16, 16, 16, 16,
+  18, 18, 18, 18, 18, 18, 18, 18, 16, 20,  0,  0,  0,  0,  0,  0,
+   4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,  4,
+};
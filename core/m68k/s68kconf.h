@@ -72,6 +72,23 @@
  */
 #define M68K_CHECK_PC_ADDRESS_ERROR OPT_OFF
 
+/* If ON, the CPU will detect short loops which only read memory (typically
+ * polling a RAM flag set by interrupt handler) and fast-forward them until
+ * the end of current execution frame. Memory accessed through I/O handlers
+ * is considered unstable unless the callback returns a non-zero cycle count
+ * until which the read value is guaranteed not to change.
+ */
+#define M68K_IDLE_LOOP_SKIP         OPT_ON
+
+/* If ON, executed instructions are recorded into predecoded traces indexed by
+ * their start address, so that opcode handler and base cycles lookups are
+ * skipped when the same code is executed again. Instruction words are always
+ * compared with memory content before being executed from a trace, which
+ * keeps self-modifying code and bank-switched areas safe.
+ * Kept OFF for the SUB-CPU until validated with Mega CD BIOS and games.
+ */
+#define M68K_INSTRUCTION_CACHE      OPT_OFF
+
 
 /* ----------------------------- COMPATIBILITY ---------------------------- */
 
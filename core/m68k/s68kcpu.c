@@ -11,10 +11,6 @@ extern int scd_68k_irq_ack(int level);
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
-#ifndef BUILD_TABLES
-#include "s68ki_cycles.h"
-#endif
-
 #include "s68kconf.h"
 #include "m68kcpu.h"
 #include "m68kops.h"
@@ -23,9 +19,6 @@ extern int scd_68k_irq_ack(int level);
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-#ifdef BUILD_TABLES
-static unsigned char s68ki_cycles[0x10000];
-#endif
 static int irq_latency;
 
 /* IRQ priority */
@@ -217,6 +210,7 @@ void s68k_update_irq(unsigned int mask)
 #endif
 }
 
+
 void s68k_run(unsigned int cycles) 
 {
   /* Make sure CPU is not already ahead */
@@ -238,6 +232,14 @@ void s68k_run(unsigned int cycles)
   /* Save end cycles count for when CPU is stopped */
   s68k.cycle_end = cycles;
 
+#if M68K_IDLE_LOOP_SKIP
+  /* Restart idle loop detection (memory might have been modified since last execution frame) */
+  if (s68k.loop.detected)
+  {
+    s68k.loop.detected = 1;
+  }
+#endif
+
   /* Return point for when we have an address error (TODO: use goto) */
   m68ki_set_address_error_trap() /* auto-disable (see m68kcpu.h) */
 
@@ -253,12 +255,17 @@ void s68k_run(unsigned int cycles)
     /* Set the address space for reads */
     m68ki_use_data_space() /* auto-disable (see m68kcpu.h) */
 
+#if M68K_INSTRUCTION_CACHE
+    /* Execute predecoded instructions */
+    m68ki_cache_execute(cycles);
+#else
     /* Decode next instruction */
     REG_IR = m68ki_read_imm_16();
 
     /* Execute instruction */
-	m68ki_instruction_jump_table[REG_IR]();
-    USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+	m68ki_instruction_handler(REG_IR)();
+    USE_CYCLES(CYC_INSTRUCTION(REG_IR));
+#endif
 
     /* Trace m68k_exception, if necessary */
     m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
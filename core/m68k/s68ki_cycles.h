@@ -1,4099 +0,0 @@
-static const unsigned char m68ki_cycles[0x10000] =
-{
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,   0*4,   0*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4, 
-   34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  34*4,  32*4,  36*4,  32*4,  34*4,  28*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4, 
-   30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  28*4,  32*4,  28*4,  30*4,  24*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4, 
-   28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  28*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  32*4,  30*4,  34*4,  30*4,  32*4,  26*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,  24*4,  26*4,  20*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,  22*4,  24*4,  18*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  20*4,  24*4,  20*4,  22*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  16*4,  20*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4, 
-   24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  22*4,  26*4,   0*4,   0*4,   4*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   4*4,   4*4,  20*4,   0*4,  16*4,   4*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  18*4,  20*4,  18*4,  22*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  10*4,  12*4,  10*4,  14*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,   8*4,  12*4,   8*4,  12*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  14*4,  18*4,  14*4,  16*4,  10*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  14*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,   8*4,  12*4,   8*4,  10*4,   4*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  10*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  12*4,  16*4,  12*4,  14*4,   8*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,  16*4,  18*4,  12*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4,  30*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4, 
-   22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  22*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4,  24*4, 
-   26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  26*4,  24*4,  28*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4, 
-   16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4, 
-   20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  20*4,  18*4,  22*4,  18*4,  20*4,  16*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-   12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4,  12*4, 
-   14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  14*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4,  16*4, 
-   18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  18*4,  16*4,  20*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4,   6*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4,   8*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4,   0*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-    4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4,   4*4, 
-};
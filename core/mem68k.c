@@ -265,12 +265,6 @@ static void m68k_poll_sync(reg)
   /* relative SUB-CPU cycle counter */
   unsigned int cycles = (m68k.cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE;
 
-  /* sync SUB-CPU with MAIN-CPU */
-  if (!s68k.stopped && (s68k.cycles < cycles))
-  {
-    s68k_run(cycles);
-  }
-
   /* SUB-CPU stopped on register polling ? */
   if (s68k.stopped & (3 << reg))
   {
@@ -332,6 +326,9 @@ unsigned int ctrl_io_read_byte(unsigned int address)
         /* register index ($A12000-A1203F mirrored up to $A120FF) */
         uint8 index = address & 0x3f;
 
+        /* sync SUB-CPU with MAIN-CPU */
+        scd_sync(m68k.cycles);
+
         /* Memory Mode */
         if (index == 0x03)
         {
@@ -342,15 +339,6 @@ unsigned int ctrl_io_read_byte(unsigned int address)
         /* SUB-CPU communication flags */
         if (index == 0x0f)
         {
-          /* relative SUB-CPU cycle counter */
-          unsigned int cycles = (m68k.cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE;
-
-          /* sync SUB-CPU with MAIN-CPU (Dracula Unleashed w/ Sega CD Model 2 OS ROM) */
-          if (!s68k.stopped && (s68k.cycles < cycles))
-          {
-            s68k_run(cycles);
-          }
-
           m68k_poll_detect(0x0f);
           return scd.regs[0x0f>>1].byte.l;
         }
@@ -463,6 +451,9 @@ unsigned int ctrl_io_read_word(unsigned int address)
         /* register index ($A12000-A1203F mirrored up to $A120FF) */
         uint8 index = address & 0x3f;
 
+        /* sync SUB-CPU with MAIN-CPU */
+        scd_sync(m68k.cycles);
+
         /* Memory Mode */
         if (index == 0x02)
         {
@@ -597,6 +588,9 @@ void ctrl_io_write_byte(unsigned int address, unsigned int data)
 #endif
       if (system_hw == SYSTEM_MCD)
       {
+        /* sync SUB-CPU with MAIN-CPU */
+        scd_sync(m68k.cycles);
+
         /* register index ($A12000-A1203F mirrored up to $A120FF) */
         switch (address & 0x3f)
         {
@@ -608,15 +602,6 @@ void ctrl_io_write_byte(unsigned int address, unsigned int data)
               /* level 2 interrupt enabled ? */
               if (scd.regs[0x32>>1].byte.l & 0x04)
               {
-                /* relative SUB-CPU cycle counter */
-                unsigned int cycles = (m68k.cycles * SCYCLES_PER_LINE) / MCYCLES_PER_LINE;
-
-                /* sync SUB-CPU with MAIN-CPU */
-                if (!s68k.stopped && (s68k.cycles < cycles))
-                {
-                  s68k_run(cycles);
-                }
-
                 /* set IFL2 flag */
                 scd.regs[0x00].byte.h |= 0x01;
 
@@ -676,6 +661,9 @@ void ctrl_io_write_byte(unsigned int address, unsigned int data)
           {
             m68k_poll_sync(0x02);
 
+            /* render pending image lines before Word-RAM is reassigned */
+            gfx_flush();
+
             /* PRG-RAM 128k bank mapped to $020000-$03FFFF (resp. $420000-$43FFFF) */
             m68k.memory_map[scd.cartridge.boot + 0x02].base = scd.prg_ram + ((data & 0xc0) << 11);
             m68k.memory_map[scd.cartridge.boot + 0x03].base = m68k.memory_map[scd.cartridge.boot + 0x02].base + 0x10000;
@@ -763,6 +751,11 @@ void ctrl_io_write_byte(unsigned int address, unsigned int data)
 
     case 0x30:  /* TIME */
     {
+      /* resynchronize Z80 before cartridge mapping is modified */
+      if (zstate == 1)
+      {
+        z80_run(m68k.cycles);
+      }
       cart.hw.time_w(address, data);
       return;
     }
@@ -830,6 +823,9 @@ void ctrl_io_write_word(unsigned int address, unsigned int data)
 #endif
       if (system_hw == SYSTEM_MCD)
       {
+        /* sync SUB-CPU with MAIN-CPU */
+        scd_sync(m68k.cycles);
+
         /* register index ($A12000-A1203F mirrored up to $A120FF) */
         switch (address & 0x3e)
         {
@@ -889,6 +885,9 @@ void ctrl_io_write_word(unsigned int address, unsigned int data)
           {
             m68k_poll_sync(0x02);
 
+            /* render pending image lines before Word-RAM is reassigned */
+            gfx_flush();
+
             /* PRG-RAM 128k bank mapped to $020000-$03FFFF (resp. $420000-$43FFFF) */
             m68k.memory_map[scd.cartridge.boot + 0x02].base = scd.prg_ram + ((data & 0xc0) << 11);
             m68k.memory_map[scd.cartridge.boot + 0x03].base = m68k.memory_map[scd.cartridge.boot + 0x02].base + 0x10000;
@@ -969,6 +968,11 @@ void ctrl_io_write_word(unsigned int address, unsigned int data)
 
     case 0x30:  /* TIME */
     {
+      /* resynchronize Z80 before cartridge mapping is modified */
+      if (zstate == 1)
+      {
+        z80_run(m68k.cycles);
+      }
       cart.hw.time_w(address, data);
       return;
     }
@@ -1115,6 +1119,17 @@ unsigned int vdp_read_word(unsigned int address)
   }
 }
 
+unsigned int vdp_read_idle(unsigned int address, unsigned int cycles)
+{
+  /* VDP status is the only I/O register which can be polled by 68k idle loops */
+  if ((m68k.memory_map[(address >> 16) & 0xff].read16 == vdp_read_word) && ((address & 0xFC) == 0x04))
+  {
+    return vdp_68k_ctrl_idle(cycles);
+  }
+
+  return 0;
+}
+
 void vdp_write_byte(unsigned int address, unsigned int data)
 {
   switch (address & 0xFC)
@@ -1136,6 +1151,11 @@ void vdp_write_byte(unsigned int address, unsigned int data)
     {
       if (address & 1)
       {
+        /* resynchronize Z80 so that PSG writes from both CPUs remain ordered */
+        if (zstate == 1)
+        {
+          z80_run(m68k.cycles);
+        }
         SN76489_Write(m68k.cycles, data);
         return;
       }
@@ -1182,6 +1202,11 @@ void vdp_write_word(unsigned int address, unsigned int data)
     case 0x10:  /* PSG */
     case 0x14:
     {
+      /* resynchronize Z80 so that PSG writes from both CPUs remain ordered */
+      if (zstate == 1)
+      {
+        z80_run(m68k.cycles);
+      }
       SN76489_Write(m68k.cycles, data & 0xFF);
       return;
     }
@@ -67,6 +67,7 @@ extern void ctrl_io_write_word(unsigned int address, unsigned int data);
 /* VDP */
 extern unsigned int vdp_read_byte(unsigned int address);
 extern unsigned int vdp_read_word(unsigned int address);
+extern unsigned int vdp_read_idle(unsigned int address, unsigned int cycles);
 extern void vdp_write_byte(unsigned int address, unsigned int data);
 extern void vdp_write_word(unsigned int address, unsigned int data);
 
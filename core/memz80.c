@@ -111,6 +111,8 @@ unsigned char z80_memory_r(unsigned int address)
     {
       if ((address >> 8) == 0x7F)
       {
+        /* VDP state is shared with 68k */
+        zsync = ZSYNC_FRAMES;
         return (*zbank_memory_map[0xc0].read)(address);
       }
       return z80_unused_r(address);
@@ -121,8 +123,15 @@ unsigned char z80_memory_r(unsigned int address)
       address = zbank | (address & 0x7FFF);
       if (zbank_memory_map[address >> 16].read)
       {
+        /* 68k bus hardware is shared with 68k */
+        zsync = ZSYNC_FRAMES;
         return (*zbank_memory_map[address >> 16].read)(address);
       }
+      if (!m68k.memory_map[address >> 16].write8)
+      {
+        /* 68k bus RAM can be modified by 68k */
+        zsync = ZSYNC_FRAMES;
+      }
       return READ_BYTE(m68k.memory_map[address >> 16].base, address & 0xFFFF);
     }
   }
@@ -158,6 +167,11 @@ void z80_memory_w(unsigned int address, unsigned char data)
 
         case 0x7F: /* $7F00-$7FFF: VDP */
         {
+          /* PSG writes are time-stamped, other VDP state is shared with 68k */
+          if ((address & 0xF9) != 0x11)
+          {
+            zsync = ZSYNC_FRAMES;
+          }
           (*zbank_memory_map[0xc0].write)(address, data);
           return;
         }
@@ -172,6 +186,8 @@ void z80_memory_w(unsigned int address, unsigned char data)
 
     default: /* $8000-$FFFF: 68k bank (32K) */
     {
+      /* 68k bus is shared with 68k */
+      zsync = ZSYNC_FRAMES;
       address = zbank | (address & 0x7FFF);
       if (zbank_memory_map[address >> 16].write)
       {
@@ -184,6 +200,35 @@ void z80_memory_w(unsigned int address, unsigned char data)
   }
 }
 
+/* Z80 idle loop detection: return cycle count until which data read from specified address remains unchanged */
+unsigned int z80_memory_idle(unsigned int address)
+{
+  if (z80_readmem == z80_memory_r)
+  {
+    switch((address >> 13) & 7)
+    {
+      case 0: /* $0000-$3FFF: Z80 RAM (8K mirrored) */
+      case 1:
+      {
+        return 0xffffffff;
+      }
+
+      case 2: /* $4000-$5FFF: YM2612 */
+      {
+        return fm_read_idle();
+      }
+
+      default: /* VDP & 68k bus are shared with 68k */
+      {
+        return 0;
+      }
+    }
+  }
+
+  /* $C000-$FFFF: Z80 RAM (Master System, Game Gear & SG-1000) */
+  return (address >= 0xC000) ? 0xffffffff : 0;
+}
+
 /*--------------------------------------------------------------------------*/
 /*  Unused Port handlers                                                    */
 /*                                                                          */
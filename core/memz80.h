@@ -44,6 +44,7 @@
 
 extern unsigned char z80_memory_r(unsigned int address);
 extern void z80_memory_w(unsigned int address, unsigned char data);
+extern unsigned int z80_memory_idle(unsigned int address);
 extern unsigned char z80_unused_port_r(unsigned int port);
 extern void z80_unused_port_w(unsigned int port, unsigned char data);
 extern unsigned char z80_md_port_r(unsigned int port);
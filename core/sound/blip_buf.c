@@ -403,3 +403,27 @@ void blip_add_delta_fast( blip_t* m, unsigned time, int delta )
 	out [7] += delta * delta_unit - delta2;
 	out [8] += delta2;
 }
+
+void blip_add_deltas_fast( blip_t* m, unsigned time, int const deltas [], int count )
+{
+	fixed_t fixed = time * m->factor + m->offset;
+	buf_t* const buf = SAMPLES( m );
+	int i;
+	
+	for ( i = 0; i < count; i++, fixed += m->factor )
+	{
+		unsigned pos = (unsigned) (fixed >> pre_shift);
+		buf_t* out = buf + (pos >> frac_bits);
+		
+		int interp = pos >> (frac_bits - delta_bits) & (delta_unit - 1);
+		int delta2 = deltas [i] * interp;
+		
+#ifdef BLIP_ASSERT
+		/* Fails if buffer size was exceeded */
+		assert( out <= &SAMPLES( m ) [m->size + end_frame_extra] );
+#endif
+		
+		out [7] += deltas [i] * delta_unit - delta2;
+		out [8] += delta2;
+	}
+}
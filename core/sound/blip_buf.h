@@ -34,6 +34,10 @@ void blip_add_delta( blip_t*, unsigned int clock_time, int delta );
 /** Same as blip_add_delta(), but uses faster, lower-quality synthesis. */
 void blip_add_delta_fast( blip_t*, unsigned int clock_time, int delta );
 
+/** Same as blip_add_delta_fast(), but adds 'count' deltas at consecutive clock
+times, starting at specified clock time. */
+void blip_add_deltas_fast( blip_t*, unsigned int clock_time, int const deltas [], int count );
+
 /** Length of time frame, in clocks, needed to make sample_count additional
 samples available. */
 int blip_clocks_needed( const blip_t*, int sample_count );
@@ -273,3 +273,18 @@ unsigned int fm_read(unsigned int cycles, unsigned int address)
   /* read FM status (YM2612 only) */
   return YM2612Read();
 }
+
+/* Return cycle count until which FM status read remains unchanged (used by Z80 idle loop detection) */
+unsigned int fm_read_idle(void)
+{
+  /* FM status is only modified by timers overflow (YM2612 only) */
+  unsigned int samples = YM2612StatusSamples();
+
+  if (!samples)
+  {
+    return 0xffffffff;
+  }
+
+  /* overflow is visible once the sample where it occurs has been started */
+  return fm_cycles_count + ((samples - 1) * fm_cycles_ratio) + 1;
+}
@@ -1981,6 +1981,30 @@ unsigned int YM2612Read(void)
   return ym2612.OPN.ST.status & 0xff;
 }
 
+/* return number of samples before status is modified by timers overflow (0 if status can not be modified) */
+unsigned int YM2612StatusSamples(void)
+{
+  unsigned int samples = 0;
+
+  /* timer A is running and overflow flag is enabled but not yet set */
+  if (((ym2612.OPN.ST.mode & 0x05) == 0x05) && !(ym2612.OPN.ST.status & 0x01))
+  {
+    samples = (ym2612.OPN.ST.TAC > 1) ? ym2612.OPN.ST.TAC : 1;
+  }
+
+  /* timer B is running and overflow flag is enabled but not yet set */
+  if (((ym2612.OPN.ST.mode & 0x0A) == 0x0A) && !(ym2612.OPN.ST.status & 0x02))
+  {
+    unsigned int samplesB = (ym2612.OPN.ST.TBC > 1) ? ym2612.OPN.ST.TBC : 1;
+    if (!samples || (samplesB < samples))
+    {
+      samples = samplesB;
+    }
+  }
+
+  return samples;
+}
+
 /* Generate samples for ym2612 */
 void YM2612Update(int *buffer, int length)
 {
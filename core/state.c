@@ -92,6 +92,9 @@ int state_load(unsigned char *state)
       m68k.memory_map[0xa0].write8  = m68k_unused_8_w;
       m68k.memory_map[0xa0].write16 = m68k_unused_16_w;
     }
+
+    /* Z80 runs in lock-step with 68k after state loading, whatever the previous timeline was */
+    zsync = ZSYNC_FRAMES;
   }
   else
   {
@@ -42,6 +42,11 @@
 #include "shared.h"
 #include "eq.h"
 
+#ifdef LOW_MEMORY
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+
 /* Global variables */
 t_bitmap bitmap;
 t_snd snd;
@@ -338,6 +343,35 @@ void system_reset(void)
   audio_reset();
 }
 
+#ifdef LOW_MEMORY
+void system_release(void *ptr, unsigned int size)
+{
+  /* only whole pages can be released, they are zero-filled again on next access */
+  uintptr_t page = sysconf(_SC_PAGESIZE);
+  uintptr_t start = ((uintptr_t)ptr + page - 1) & ~(page - 1);
+  uintptr_t end = ((uintptr_t)ptr + size) & ~(page - 1);
+  if (end > start)
+  {
+    madvise((void *)start, end - start, MADV_DONTNEED);
+  }
+}
+
+void system_shutdown(void)
+{
+  /* cartridge area (including SVP, SRAM, BOOT ROM, lock-on & cheat ROM) */
+  system_release(cart.rom, sizeof(cart.rom));
+
+  /* Mega CD hardware (including BOOT ROM, PRG-RAM, Word-RAM & CDC RAM) */
+  if (system_hw == SYSTEM_MCD)
+  {
+    system_release(&scd, sizeof(scd));
+  }
+
+  /* BOOT ROM need to be reloaded */
+  system_bios &= ~(0x10 | SYSTEM_SMS | SYSTEM_GG);
+}
+#endif
+
 void system_frame_gen(int do_skip)
 {
   /* line counters */
@@ -452,7 +486,11 @@ void system_frame_gen(int do_skip)
   m68k_run(MCYCLES_PER_LINE);
   if (zstate == 1)
   {
-    z80_run(MCYCLES_PER_LINE);
+    /* Z80 is run on demand unless it recently accessed shared hardware */
+    if (zsync)
+    {
+      z80_run(MCYCLES_PER_LINE);
+    }
   }
   else
   {
@@ -507,7 +545,11 @@ void system_frame_gen(int do_skip)
     m68k_run(mcycles_vdp + MCYCLES_PER_LINE);
     if (zstate == 1)
     {
-      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      /* Z80 is run on demand unless it recently accessed shared hardware */
+      if (zsync)
+      {
+        z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      }
     }
     else
     {
@@ -604,7 +646,11 @@ void system_frame_gen(int do_skip)
   m68k_run(mcycles_vdp + MCYCLES_PER_LINE);
   if (zstate == 1)
   {
-    z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+    /* Z80 is run on demand unless it recently accessed shared hardware */
+    if (zsync)
+    {
+      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+    }
   }
   else
   {
@@ -660,7 +706,11 @@ void system_frame_gen(int do_skip)
     m68k_run(mcycles_vdp + MCYCLES_PER_LINE);
     if (zstate == 1)
     {
-      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      /* Z80 is run on demand unless it recently accessed shared hardware */
+      if (zsync)
+      {
+        z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      }
     }
     else
     {
@@ -678,6 +728,18 @@ void system_frame_gen(int do_skip)
   }
   while (++line < (lines_per_frame - 1));
 
+  /* resynchronize Z80 with 68k */
+  if (zstate == 1)
+  {
+    z80_run(mcycles_vdp);
+  }
+
+  /* update Z80 lock-step frame counter */
+  if (zsync)
+  {
+    zsync--;
+  }
+
   /* adjust CPU cycle counters for next frame */
   m68k.cycles -= mcycles_vdp;
   Z80.cycles -= mcycles_vdp;
@@ -800,7 +862,11 @@ void system_frame_scd(int do_skip)
   /* run Z80 */
   if (zstate == 1)
   {
-    z80_run(MCYCLES_PER_LINE);
+    /* Z80 is run on demand unless it recently accessed shared hardware */
+    if (zsync)
+    {
+      z80_run(MCYCLES_PER_LINE);
+    }
   }
   else
   {
@@ -851,7 +917,11 @@ void system_frame_scd(int do_skip)
     /* run Z80 */
     if (zstate == 1)
     {
-      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      /* Z80 is run on demand unless it recently accessed shared hardware */
+      if (zsync)
+      {
+        z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      }
     }
     else
     {
@@ -944,7 +1014,11 @@ void system_frame_scd(int do_skip)
   /* run Z80 until end of line */
   if (zstate == 1)
   {
-    z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+    /* Z80 is run on demand unless it recently accessed shared hardware */
+    if (zsync)
+    {
+      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+    }
   }
   else
   {
@@ -996,7 +1070,11 @@ void system_frame_scd(int do_skip)
     /* run Z80 */
     if (zstate == 1)
     {
-      z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      /* Z80 is run on demand unless it recently accessed shared hardware */
+      if (zsync)
+      {
+        z80_run(mcycles_vdp + MCYCLES_PER_LINE);
+      }
     }
     else
     {
@@ -1008,6 +1086,21 @@ void system_frame_scd(int do_skip)
   }
   while (++line < (lines_per_frame - 1));
   
+  /* resynchronize Z80 with 68k */
+  if (zstate == 1)
+  {
+    z80_run(mcycles_vdp);
+  }
+
+  /* update Z80 lock-step frame counter */
+  if (zsync)
+  {
+    zsync--;
+  }
+
+  /* sync SUB-CPU with MAIN-CPU until end of frame */
+  scd_sync(mcycles_vdp);
+
   /* prepare for next SCD frame */
   scd_end_frame(scd.cycles);
 
@@ -111,6 +111,10 @@ extern int audio_update(int16 *buffer);
 extern void audio_set_equalizer(void);
 extern void system_init(void);
 extern void system_reset(void);
+#ifdef LOW_MEMORY
+extern void system_release(void *ptr, unsigned int size);
+extern void system_shutdown(void);
+#endif
 extern void system_frame_gen(int do_skip);
 extern void system_frame_scd(int do_skip);
 extern void system_frame_sms(int do_skip);
@@ -1258,6 +1258,36 @@ unsigned int vdp_68k_ctrl_r(unsigned int cycles)
   return (temp);
 }
 
+/* Return cycle count until which VDP status read by 68k after specified cycle remains unchanged (used by 68k idle loop detection) */
+unsigned int vdp_68k_ctrl_idle(unsigned int cycles)
+{
+  unsigned int limit = cycles - (cycles % MCYCLES_PER_LINE);
+
+  /* FIFO flags are updated on each FIFO read */
+  if (fifo_write_cnt > 0)
+  {
+    return 0;
+  }
+
+  /* HBLANK flag is updated twice per line */
+  if ((cycles % MCYCLES_PER_LINE) < 588)
+  {
+    limit += 588;
+  }
+  else
+  {
+    limit += MCYCLES_PER_LINE;
+  }
+
+  /* DMA Busy flag is cleared once DMA is finished */
+  if ((status & 2) && !dma_length && (dma_endCycles < limit))
+  {
+    limit = dma_endCycles;
+  }
+
+  return limit;
+}
+
 unsigned int vdp_z80_ctrl_r(unsigned int cycles)
 {
   unsigned int temp;
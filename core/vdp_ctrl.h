@@ -96,6 +96,7 @@ extern void vdp_z80_ctrl_w(unsigned int data);
 extern void vdp_sms_ctrl_w(unsigned int data);
 extern void vdp_tms_ctrl_w(unsigned int data);
 extern unsigned int vdp_68k_ctrl_r(unsigned int cycles);
+extern unsigned int vdp_68k_ctrl_idle(unsigned int cycles);
 extern unsigned int vdp_z80_ctrl_r(unsigned int cycles);
 extern unsigned int vdp_hvc_r(unsigned int cycles);
 extern void vdp_test_w(unsigned int data);
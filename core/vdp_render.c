@@ -561,6 +561,9 @@ static uint32 bp_lut[0x10000];
 /* Layer priority pixel look-up tables */
 static uint8 lut[LUT_MAX][LUT_SIZE];
 
+/* Look-up tables initialization flags (bit 0: Mode 5, bit 1: Mode 4) */
+static uint8 lut_init;
+
 /* Output pixel data look-up tables*/
 static PIXEL_OUT_T pixel[0x100];
 static PIXEL_OUT_T pixel_lut[3][0x200];
@@ -3977,32 +3980,52 @@ void window_clip(unsigned int data, unsigned int sw)
 void render_init(void)
 {
   int bx, ax;
-
-  /* Initialize layers priority pixel look-up tables */
   uint16 index;
-  for (bx = 0; bx < 0x100; bx++)
+
+  /* Mode 5 look-up tables are only needed by Mega Drive hardware and are kept once built */
+  if ((system_hw & SYSTEM_MD) && !(lut_init & 1))
   {
-    for (ax = 0; ax < 0x100; ax++)
+    /* Initialize layers priority pixel look-up tables */
+    for (bx = 0; bx < 0x100; bx++)
     {
-      index = (bx << 8) | (ax);
-
-      lut[0][index] = make_lut_bg(bx, ax);
-      lut[1][index] = make_lut_bgobj(bx, ax);
-      lut[2][index] = make_lut_bg_ste(bx, ax);
-      lut[3][index] = make_lut_obj(bx, ax);
-      lut[4][index] = make_lut_bgobj_ste(bx, ax);
-      lut[5][index] = make_lut_bgobj_m4(bx,ax);
+      for (ax = 0; ax < 0x100; ax++)
+      {
+        index = (bx << 8) | (ax);
+
+        lut[0][index] = make_lut_bg(bx, ax);
+        lut[1][index] = make_lut_bgobj(bx, ax);
+        lut[2][index] = make_lut_bg_ste(bx, ax);
+        lut[3][index] = make_lut_obj(bx, ax);
+        lut[4][index] = make_lut_bgobj_ste(bx, ax);
+      }
     }
+
+    /* Make sprite pattern name index look-up table (Mode 5) */
+    make_name_lut();
+
+    lut_init |= 1;
   }
 
-  /* Initialize pixel color look-up tables */
-  palette_init();
+  /* Mode 4 look-up tables are needed by all hardware */
+  if (!(lut_init & 2))
+  {
+    /* Initialize layers priority pixel look-up table */
+    for (bx = 0; bx < 0x100; bx++)
+    {
+      for (ax = 0; ax < 0x100; ax++)
+      {
+        lut[5][(bx << 8) | (ax)] = make_lut_bgobj_m4(bx,ax);
+      }
+    }
 
-  /* Make sprite pattern name index look-up table (Mode 5) */
-  make_name_lut();
+    /* Make bitplane to pixel look-up table (Mode 4) */
+    make_bp_lut();
 
-  /* Make bitplane to pixel look-up table (Mode 4) */
-  make_bp_lut();
+    lut_init |= 2;
+  }
+
+  /* Initialize pixel color look-up tables */
+  palette_init();
 }
 
 void render_reset(void)
@@ -4017,6 +4040,15 @@ void render_reset(void)
   memset(pixel, 0, sizeof(pixel));
 
   /* Clear pattern cache */
+#ifdef LOW_MEMORY
+  if (system_hw < SYSTEM_MD)
+  {
+    /* Mode 4 only uses the first 128K (512 patterns, 4 flipped versions) */
+    memset ((char *) bg_pattern_cache, 0, 0x20000);
+    system_release(bg_pattern_cache + 0x20000, sizeof (bg_pattern_cache) - 0x20000);
+  }
+  else
+#endif
   memset ((char *) bg_pattern_cache, 0, sizeof (bg_pattern_cache));
 
   /* Reset Sprite infos */
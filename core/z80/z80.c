@@ -38,6 +38,8 @@
  *    - Implemented cycle-accurate INI/IND (needed by SMS emulation)
  *    - Fixed Z80 reset
  *    - Made SZHVC_add & SZHVC_sub tables statically allocated
+ *    - Implemented idle loop detection (loops only reading memory are fast-forwarded)
+ *    - Added threaded dispatch of main opcodes using computed gotos (GCC only)
  *   Changes in 3.9:
  *    - Fixed cycle counts for LD IYL/IXL/IYH/IXH,n [Marshmellow]
  *    - Fixed X/Y flags in CCF/SCF/BIT, ZEXALL is happy now [hap]
@@ -129,6 +131,13 @@
 /* execute main opcodes inside a big switch statement */
 #define BIG_SWITCH 1
 
+/* execute main opcodes with one indirect jump per opcode handler (labels as values, not available in strict ANSI mode) */
+#if defined(__GNUC__) && !defined(__STRICT_ANSI__)
+#define THREADED_DISPATCH 1
+#else
+#define THREADED_DISPATCH 0
+#endif
+
 #define VERBOSE 0
 
 #if VERBOSE
@@ -477,6 +486,208 @@ INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
   }
 }
 
+/***************************************************************
+ * Idle loop detection
+ * A short JR/JP backward loop is considered idle when its body only
+ * reads memory into A register or flags, and when CPU state at the end
+ * of one iteration is identical to the one at the end of the previous
+ * iteration. Since interrupt lines are only modified between two calls
+ * to z80_run, following iterations would then produce the exact same
+ * result until the end of current execution, or until memory read by
+ * the loop is modified by hardware (see z80_memory_idle).
+ * Loop body cannot contain any branch so that iteration duration can be
+ * used to verify that no other instructions were executed since previous
+ * iteration.
+ ***************************************************************/
+#define IDLE_LOOP_SIZE 16
+
+static struct
+{
+  UINT32 pc;        /* loop branch instruction address */
+  UINT32 cycle;     /* cycle count at previous loop iteration */
+  UINT32 cycle_end; /* cycle count at the end of current execution */
+  UINT32 detected;  /* 0: not an idle loop, 1: idle loop candidate, 2: previous iteration state saved */
+  UINT16 regs[8];   /* AF, BC, DE, HL, IX, IY, SP & WZ at previous loop iteration */
+} idle;
+
+/* check memory read by loop body (limit is NULL when only checking loop instructions) */
+INLINE int IDLE_READ(UINT32 address, UINT32 *limit)
+{
+  if (limit)
+  {
+    UINT32 cycle = z80_memory_idle(address & 0xffff);
+    if (cycle < *limit)
+    {
+      *limit = cycle;
+    }
+    return (cycle != 0);
+  }
+
+  return 1;
+}
+
+/* check loop body instructions and return loop iteration duration (0 if not allowed) */
+static UINT32 idle_loop_check(UINT32 pc, UINT32 end, UINT32 *limit, UINT32 *opcodes)
+{
+  UINT32 cycles = 0;
+  UINT32 count = 0;
+  unsigned op;
+
+  while (pc < end)
+  {
+    op = cpu_readop(pc);
+    pc++;
+    count++;
+
+    if (op == 0xcb)
+    {
+      op = cpu_readop(pc & 0xffff);
+      pc++;
+      count++;
+
+      if ((op & 0xc0) == 0x40)
+      {
+        /* BIT b,(HL) */
+        if (((op & 7) == 6) && !IDLE_READ(HL, limit))
+        {
+          return 0;
+        }
+      }
+      else if ((op & 7) != 7)
+      {
+        /* only shift, rotate, SET & RES on A register are allowed */
+        return 0;
+      }
+
+      cycles += cc[Z80_TABLE_cb][op];
+      continue;
+    }
+
+    switch (op)
+    {
+      case 0x00: /* NOP */
+      case 0x07: /* RLCA */
+      case 0x0f: /* RRCA */
+      case 0x17: /* RLA */
+      case 0x1f: /* RRA */
+      case 0x27: /* DAA */
+      case 0x2f: /* CPL */
+      case 0x37: /* SCF */
+      case 0x3c: /* INC A */
+      case 0x3d: /* DEC A */
+      case 0x3f: /* CCF */
+      case 0x78: case 0x79: case 0x7a: case 0x7b: case 0x7c: case 0x7d: case 0x7f: /* LD A,r */
+        break;
+
+      case 0x0a: /* LD A,(BC) */
+        if (!IDLE_READ(BC, limit)) return 0;
+        break;
+
+      case 0x1a: /* LD A,(DE) */
+        if (!IDLE_READ(DE, limit)) return 0;
+        break;
+
+      case 0x7e: /* LD A,(HL) */
+        if (!IDLE_READ(HL, limit)) return 0;
+        break;
+
+      case 0x3a: /* LD A,(w) */
+        if (!IDLE_READ(cpu_readop_arg(pc & 0xffff) | (cpu_readop_arg((pc+1) & 0xffff) << 8), limit)) return 0;
+        pc += 2;
+        break;
+
+      case 0x3e: /* LD A,n */
+        pc++;
+        break;
+
+      default:
+        if ((op & 0xc0) == 0x80)
+        {
+          /* ADD/ADC/SUB/SBC/AND/XOR/OR/CP A,r & A,(HL) */
+          if (((op & 7) == 6) && !IDLE_READ(HL, limit)) return 0;
+        }
+        else if ((op & 0xc7) == 0xc6)
+        {
+          /* ADD/ADC/SUB/SBC/AND/XOR/OR/CP A,n */
+          pc++;
+        }
+        else
+        {
+          return 0;
+        }
+        break;
+    }
+
+    cycles += cc[Z80_TABLE_op][op];
+  }
+
+  if (pc != end)
+  {
+    return 0;
+  }
+
+  /* loop branch instruction (JR, JR cc, JP, JP cc) */
+  op = cpu_readop(end);
+  if ((op != 0x18) && ((op & 0xe7) != 0x20) && (op != 0xc3) && ((op & 0xc7) != 0xc2))
+  {
+    return 0;
+  }
+
+  *opcodes = count + 1;
+  return cycles + cc[Z80_TABLE_op][op] + cc[Z80_TABLE_ex][op];
+}
+
+static void idle_loop_detect(UINT32 branch)
+{
+  UINT16 regs[8];
+  UINT32 opcodes;
+
+  regs[0] = AF;
+  regs[1] = BC;
+  regs[2] = DE;
+  regs[3] = HL;
+  regs[4] = IX;
+  regs[5] = IY;
+  regs[6] = SP;
+  regs[7] = WZ;
+
+  if (idle.pc != branch)
+  {
+    /* new loop: check loop instructions */
+    idle.pc = branch;
+    idle.detected = (idle_loop_check(PCD, branch, NULL, &opcodes) != 0);
+  }
+  else if ((idle.detected == 2) && !memcmp(regs, idle.regs, sizeof(regs)))
+  {
+    /* loop iteration duration */
+    UINT32 cycles = Z80.cycles - idle.cycle;
+
+    /* check loop was not exited since previous iteration and memory read by loop body is stable until the end of current execution */
+    UINT32 limit = idle.cycle_end;
+    if ((idle_loop_check(PCD, branch, &limit, &opcodes) == cycles) && (limit > Z80.cycles))
+    {
+      /* skip loop iterations (last ones are executed normally to stop at the exact same cycle) */
+      UINT32 count = (limit - Z80.cycles) / cycles;
+      if (count > 1)
+      {
+        Z80.cycles += (count - 1) * cycles;
+        R += (count - 1) * opcodes;
+      }
+    }
+
+    idle.cycle = Z80.cycles;
+    return;
+  }
+
+  if (idle.detected)
+  {
+    /* save CPU state */
+    memcpy(idle.regs, regs, sizeof(regs));
+    idle.cycle = Z80.cycles;
+    idle.detected = 2;
+  }
+}
+
 /***************************************************************
  * define an opcode function
  ***************************************************************/
@@ -607,7 +818,16 @@ INLINE void BURNODD(int cycles, int opcodes, int cyclesum)
 /***************************************************************
  * Read a byte from given memory location
  ***************************************************************/
-#define RM(addr) z80_readmem(addr)
+INLINE UINT8 RM(UINT32 addr)
+{
+  /* memory handler is only needed when some areas are not directly mapped */
+  if (z80_readmem)
+  {
+    return z80_readmem(addr);
+  }
+
+  return z80_readmap[addr >> 10][addr & 0x03FF];
+}
 
 /***************************************************************
  * Write a byte to given memory location
@@ -685,8 +905,11 @@ INLINE UINT32 ARG16(void)
  * JP
  ***************************************************************/
 #define JP {                                    \
+  UINT32 branch = PCD - 1;                      \
   PCD = ARG16();                                \
   WZ = PCD;                                     \
+  if ((branch - PCD) < IDLE_LOOP_SIZE)          \
+    idle_loop_detect(branch);                   \
 }
 
 /***************************************************************
@@ -695,8 +918,11 @@ INLINE UINT32 ARG16(void)
 #define JP_COND(cond) {                         \
   if (cond)                                     \
   {                                             \
+    UINT32 branch = PCD - 1;                    \
     PCD = ARG16();                              \
     WZ = PCD;                                   \
+    if ((branch - PCD) < IDLE_LOOP_SIZE)        \
+      idle_loop_detect(branch);                 \
   }                                             \
   else                                          \
   {                                             \
@@ -711,6 +937,8 @@ INLINE UINT32 ARG16(void)
   INT8 arg = (INT8)ARG(); /* ARG() also increments PC */  \
   PC += arg;        /* so don't do PC += ARG() */         \
   WZ = PC;                                                \
+  if ((UINT8)(-2 - arg) < IDLE_LOOP_SIZE)                 \
+    idle_loop_detect((PCD - arg - 2) & 0xffff);           \
 }
 
 /***************************************************************
@@ -3395,6 +3623,140 @@ void z80_reset(void)
  ****************************************************************************/
 void z80_run(unsigned int cycles)
 {
+  /* restart idle loop detection (memory might have been modified since last execution) */
+  if (idle.detected)
+  {
+    idle.detected = 1;
+  }
+  idle.cycle_end = cycles;
+
+#if THREADED_DISPATCH
+  {
+    static const void * const op_label[0x100] =
+    {
+      &&op_label_00, &&op_label_01, &&op_label_02, &&op_label_03, &&op_label_04, &&op_label_05, &&op_label_06, &&op_label_07,
+      &&op_label_08, &&op_label_09, &&op_label_0a, &&op_label_0b, &&op_label_0c, &&op_label_0d, &&op_label_0e, &&op_label_0f,
+      &&op_label_10, &&op_label_11, &&op_label_12, &&op_label_13, &&op_label_14, &&op_label_15, &&op_label_16, &&op_label_17,
+      &&op_label_18, &&op_label_19, &&op_label_1a, &&op_label_1b, &&op_label_1c, &&op_label_1d, &&op_label_1e, &&op_label_1f,
+      &&op_label_20, &&op_label_21, &&op_label_22, &&op_label_23, &&op_label_24, &&op_label_25, &&op_label_26, &&op_label_27,
+      &&op_label_28, &&op_label_29, &&op_label_2a, &&op_label_2b, &&op_label_2c, &&op_label_2d, &&op_label_2e, &&op_label_2f,
+      &&op_label_30, &&op_label_31, &&op_label_32, &&op_label_33, &&op_label_34, &&op_label_35, &&op_label_36, &&op_label_37,
+      &&op_label_38, &&op_label_39, &&op_label_3a, &&op_label_3b, &&op_label_3c, &&op_label_3d, &&op_label_3e, &&op_label_3f,
+      &&op_label_40, &&op_label_41, &&op_label_42, &&op_label_43, &&op_label_44, &&op_label_45, &&op_label_46, &&op_label_47,
+      &&op_label_48, &&op_label_49, &&op_label_4a, &&op_label_4b, &&op_label_4c, &&op_label_4d, &&op_label_4e, &&op_label_4f,
+      &&op_label_50, &&op_label_51, &&op_label_52, &&op_label_53, &&op_label_54, &&op_label_55, &&op_label_56, &&op_label_57,
+      &&op_label_58, &&op_label_59, &&op_label_5a, &&op_label_5b, &&op_label_5c, &&op_label_5d, &&op_label_5e, &&op_label_5f,
+      &&op_label_60, &&op_label_61, &&op_label_62, &&op_label_63, &&op_label_64, &&op_label_65, &&op_label_66, &&op_label_67,
+      &&op_label_68, &&op_label_69, &&op_label_6a, &&op_label_6b, &&op_label_6c, &&op_label_6d, &&op_label_6e, &&op_label_6f,
+      &&op_label_70, &&op_label_71, &&op_label_72, &&op_label_73, &&op_label_74, &&op_label_75, &&op_label_76, &&op_label_77,
+      &&op_label_78, &&op_label_79, &&op_label_7a, &&op_label_7b, &&op_label_7c, &&op_label_7d, &&op_label_7e, &&op_label_7f,
+      &&op_label_80, &&op_label_81, &&op_label_82, &&op_label_83, &&op_label_84, &&op_label_85, &&op_label_86, &&op_label_87,
+      &&op_label_88, &&op_label_89, &&op_label_8a, &&op_label_8b, &&op_label_8c, &&op_label_8d, &&op_label_8e, &&op_label_8f,
+      &&op_label_90, &&op_label_91, &&op_label_92, &&op_label_93, &&op_label_94, &&op_label_95, &&op_label_96, &&op_label_97,
+      &&op_label_98, &&op_label_99, &&op_label_9a, &&op_label_9b, &&op_label_9c, &&op_label_9d, &&op_label_9e, &&op_label_9f,
+      &&op_label_a0, &&op_label_a1, &&op_label_a2, &&op_label_a3, &&op_label_a4, &&op_label_a5, &&op_label_a6, &&op_label_a7,
+      &&op_label_a8, &&op_label_a9, &&op_label_aa, &&op_label_ab, &&op_label_ac, &&op_label_ad, &&op_label_ae, &&op_label_af,
+      &&op_label_b0, &&op_label_b1, &&op_label_b2, &&op_label_b3, &&op_label_b4, &&op_label_b5, &&op_label_b6, &&op_label_b7,
+      &&op_label_b8, &&op_label_b9, &&op_label_ba, &&op_label_bb, &&op_label_bc, &&op_label_bd, &&op_label_be, &&op_label_bf,
+      &&op_label_c0, &&op_label_c1, &&op_label_c2, &&op_label_c3, &&op_label_c4, &&op_label_c5, &&op_label_c6, &&op_label_c7,
+      &&op_label_c8, &&op_label_c9, &&op_label_ca, &&op_label_cb, &&op_label_cc, &&op_label_cd, &&op_label_ce, &&op_label_cf,
+      &&op_label_d0, &&op_label_d1, &&op_label_d2, &&op_label_d3, &&op_label_d4, &&op_label_d5, &&op_label_d6, &&op_label_d7,
+      &&op_label_d8, &&op_label_d9, &&op_label_da, &&op_label_db, &&op_label_dc, &&op_label_dd, &&op_label_de, &&op_label_df,
+      &&op_label_e0, &&op_label_e1, &&op_label_e2, &&op_label_e3, &&op_label_e4, &&op_label_e5, &&op_label_e6, &&op_label_e7,
+      &&op_label_e8, &&op_label_e9, &&op_label_ea, &&op_label_eb, &&op_label_ec, &&op_label_ed, &&op_label_ee, &&op_label_ef,
+      &&op_label_f0, &&op_label_f1, &&op_label_f2, &&op_label_f3, &&op_label_f4, &&op_label_f5, &&op_label_f6, &&op_label_f7,
+      &&op_label_f8, &&op_label_f9, &&op_label_fa, &&op_label_fb, &&op_label_fc, &&op_label_fd, &&op_label_fe, &&op_label_ff
+    };
+
+    /* each opcode handler directly jumps to next one (better branch prediction than a single switch) */
+#define OP_NEXT \
+    if (Z80.cycles >= cycles) return; \
+    if (Z80.irq_state && IFF1 && !Z80.after_ei) goto op_interrupt; \
+    Z80.after_ei = FALSE; \
+    R++; \
+    { unsigned op = ROP(); CC(op,op); goto *op_label[op]; }
+
+#define OP_LABEL(opcode) op_label_##opcode: op_##opcode(); OP_NEXT
+
+    OP_NEXT
+
+    /* check for IRQs before each instruction */
+op_interrupt:
+    take_interrupt();
+    if (Z80.cycles >= cycles) return;
+    Z80.after_ei = FALSE;
+    R++;
+    { unsigned op = ROP(); CC(op,op); goto *op_label[op]; }
+
+  OP_LABEL(00) OP_LABEL(01) OP_LABEL(02) OP_LABEL(03)
+  OP_LABEL(04) OP_LABEL(05) OP_LABEL(06) OP_LABEL(07)
+  OP_LABEL(08) OP_LABEL(09) OP_LABEL(0a) OP_LABEL(0b)
+  OP_LABEL(0c) OP_LABEL(0d) OP_LABEL(0e) OP_LABEL(0f)
+  OP_LABEL(10) OP_LABEL(11) OP_LABEL(12) OP_LABEL(13)
+  OP_LABEL(14) OP_LABEL(15) OP_LABEL(16) OP_LABEL(17)
+  OP_LABEL(18) OP_LABEL(19) OP_LABEL(1a) OP_LABEL(1b)
+  OP_LABEL(1c) OP_LABEL(1d) OP_LABEL(1e) OP_LABEL(1f)
+  OP_LABEL(20) OP_LABEL(21) OP_LABEL(22) OP_LABEL(23)
+  OP_LABEL(24) OP_LABEL(25) OP_LABEL(26) OP_LABEL(27)
+  OP_LABEL(28) OP_LABEL(29) OP_LABEL(2a) OP_LABEL(2b)
+  OP_LABEL(2c) OP_LABEL(2d) OP_LABEL(2e) OP_LABEL(2f)
+  OP_LABEL(30) OP_LABEL(31) OP_LABEL(32) OP_LABEL(33)
+  OP_LABEL(34) OP_LABEL(35) OP_LABEL(36) OP_LABEL(37)
+  OP_LABEL(38) OP_LABEL(39) OP_LABEL(3a) OP_LABEL(3b)
+  OP_LABEL(3c) OP_LABEL(3d) OP_LABEL(3e) OP_LABEL(3f)
+  OP_LABEL(40) OP_LABEL(41) OP_LABEL(42) OP_LABEL(43)
+  OP_LABEL(44) OP_LABEL(45) OP_LABEL(46) OP_LABEL(47)
+  OP_LABEL(48) OP_LABEL(49) OP_LABEL(4a) OP_LABEL(4b)
+  OP_LABEL(4c) OP_LABEL(4d) OP_LABEL(4e) OP_LABEL(4f)
+  OP_LABEL(50) OP_LABEL(51) OP_LABEL(52) OP_LABEL(53)
+  OP_LABEL(54) OP_LABEL(55) OP_LABEL(56) OP_LABEL(57)
+  OP_LABEL(58) OP_LABEL(59) OP_LABEL(5a) OP_LABEL(5b)
+  OP_LABEL(5c) OP_LABEL(5d) OP_LABEL(5e) OP_LABEL(5f)
+  OP_LABEL(60) OP_LABEL(61) OP_LABEL(62) OP_LABEL(63)
+  OP_LABEL(64) OP_LABEL(65) OP_LABEL(66) OP_LABEL(67)
+  OP_LABEL(68) OP_LABEL(69) OP_LABEL(6a) OP_LABEL(6b)
+  OP_LABEL(6c) OP_LABEL(6d) OP_LABEL(6e) OP_LABEL(6f)
+  OP_LABEL(70) OP_LABEL(71) OP_LABEL(72) OP_LABEL(73)
+  OP_LABEL(74) OP_LABEL(75) OP_LABEL(76) OP_LABEL(77)
+  OP_LABEL(78) OP_LABEL(79) OP_LABEL(7a) OP_LABEL(7b)
+  OP_LABEL(7c) OP_LABEL(7d) OP_LABEL(7e) OP_LABEL(7f)
+  OP_LABEL(80) OP_LABEL(81) OP_LABEL(82) OP_LABEL(83)
+  OP_LABEL(84) OP_LABEL(85) OP_LABEL(86) OP_LABEL(87)
+  OP_LABEL(88) OP_LABEL(89) OP_LABEL(8a) OP_LABEL(8b)
+  OP_LABEL(8c) OP_LABEL(8d) OP_LABEL(8e) OP_LABEL(8f)
+  OP_LABEL(90) OP_LABEL(91) OP_LABEL(92) OP_LABEL(93)
+  OP_LABEL(94) OP_LABEL(95) OP_LABEL(96) OP_LABEL(97)
+  OP_LABEL(98) OP_LABEL(99) OP_LABEL(9a) OP_LABEL(9b)
+  OP_LABEL(9c) OP_LABEL(9d) OP_LABEL(9e) OP_LABEL(9f)
+  OP_LABEL(a0) OP_LABEL(a1) OP_LABEL(a2) OP_LABEL(a3)
+  OP_LABEL(a4) OP_LABEL(a5) OP_LABEL(a6) OP_LABEL(a7)
+  OP_LABEL(a8) OP_LABEL(a9) OP_LABEL(aa) OP_LABEL(ab)
+  OP_LABEL(ac) OP_LABEL(ad) OP_LABEL(ae) OP_LABEL(af)
+  OP_LABEL(b0) OP_LABEL(b1) OP_LABEL(b2) OP_LABEL(b3)
+  OP_LABEL(b4) OP_LABEL(b5) OP_LABEL(b6) OP_LABEL(b7)
+  OP_LABEL(b8) OP_LABEL(b9) OP_LABEL(ba) OP_LABEL(bb)
+  OP_LABEL(bc) OP_LABEL(bd) OP_LABEL(be) OP_LABEL(bf)
+  OP_LABEL(c0) OP_LABEL(c1) OP_LABEL(c2) OP_LABEL(c3)
+  OP_LABEL(c4) OP_LABEL(c5) OP_LABEL(c6) OP_LABEL(c7)
+  OP_LABEL(c8) OP_LABEL(c9) OP_LABEL(ca) OP_LABEL(cb)
+  OP_LABEL(cc) OP_LABEL(cd) OP_LABEL(ce) OP_LABEL(cf)
+  OP_LABEL(d0) OP_LABEL(d1) OP_LABEL(d2) OP_LABEL(d3)
+  OP_LABEL(d4) OP_LABEL(d5) OP_LABEL(d6) OP_LABEL(d7)
+  OP_LABEL(d8) OP_LABEL(d9) OP_LABEL(da) OP_LABEL(db)
+  OP_LABEL(dc) OP_LABEL(dd) OP_LABEL(de) OP_LABEL(df)
+  OP_LABEL(e0) OP_LABEL(e1) OP_LABEL(e2) OP_LABEL(e3)
+  OP_LABEL(e4) OP_LABEL(e5) OP_LABEL(e6) OP_LABEL(e7)
+  OP_LABEL(e8) OP_LABEL(e9) OP_LABEL(ea) OP_LABEL(eb)
+  OP_LABEL(ec) OP_LABEL(ed) OP_LABEL(ee) OP_LABEL(ef)
+  OP_LABEL(f0) OP_LABEL(f1) OP_LABEL(f2) OP_LABEL(f3)
+  OP_LABEL(f4) OP_LABEL(f5) OP_LABEL(f6) OP_LABEL(f7)
+  OP_LABEL(f8) OP_LABEL(f9) OP_LABEL(fa) OP_LABEL(fb)
+  OP_LABEL(fc) OP_LABEL(fd) OP_LABEL(fe) OP_LABEL(ff)
+
+#undef OP_LABEL
+#undef OP_NEXT
+  }
+#else
   while( Z80.cycles < cycles )
   {
     /* check for IRQs before each instruction */
@@ -3408,6 +3770,7 @@ void z80_run(unsigned int cycles)
     R++;
     EXEC_INLINE(op,ROP());
   }
+#endif
 } 
 
 /****************************************************************************
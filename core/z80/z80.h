@@ -55,7 +55,7 @@ extern unsigned char *z80_readmap[64];
 extern unsigned char *z80_writemap[64];
 
 extern void (*z80_writemem)(unsigned int address, unsigned char data);
-extern unsigned char (*z80_readmem)(unsigned int address);
+extern unsigned char (*z80_readmem)(unsigned int address); /* NULL if all memory is mapped in z80_readmap */
 extern void (*z80_writeport)(unsigned int port, unsigned char data);
 extern unsigned char (*z80_readport)(unsigned int port);
 
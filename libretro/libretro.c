@@ -40,6 +40,12 @@ void retro_set_environment(retro_environment_t cb)
       { "blargg_ntsc_filter", "Blargg NTSC filter; disabled|monochrome|composite|svideo|rgb" },
       { "overscan", "Overscan mode; 0|1|2|3" },
       { "gg_extra", "Game Gear extended screen; disabled|enabled" },
+#ifdef USE_SCD_THREAD
+      { "scd_thread", "Mega CD SUB-CPU thread (experimental); disabled|enabled" },
+#endif
+#ifdef USE_ROM_CACHE
+      { "rom_cache", "Shared ROM image cache in system directory (restart); disabled|enabled" },
+#endif
       { NULL, NULL },
    };
 
@@ -93,6 +99,9 @@ char CD_BRAM_JP[256];
 char CD_BRAM_US[256];
 char CD_BRAM_EU[256];
 char CART_BRAM[256];
+#ifdef USE_ROM_CACHE
+char ROM_CACHE_PATH[256];
+#endif
 
 /* Mega CD backup RAM stuff */
 static uint32_t brm_crc[2];
@@ -242,6 +251,12 @@ static void config_default(void)
    config.bios           = 0;
    config.lock_on        = 0;
    config.hot_swap       = 0;
+#ifdef USE_SCD_THREAD
+   config.scd_thread     = 0;
+#endif
+#ifdef USE_ROM_CACHE
+   config.rom_cache      = 0;
+#endif
 
    /* video options */
    config.overscan = 0; /* 3 == FULL */
@@ -464,7 +479,11 @@ void retro_get_system_info(struct retro_system_info *info)
 {
    info->library_name = "Genesis Plus GX";
    info->library_version = "v1.7.4";
+#ifdef USE_CDZ
+   info->valid_extensions = "md|smd|bin|cue|gen|iso|cdz|sms|gg|sg";
+#else
    info->valid_extensions = "md|smd|bin|cue|gen|iso|sms|gg|sg";
+#endif
    info->block_extract = false;
    info->need_fullpath = true;
 }
@@ -677,6 +696,18 @@ static void check_variables(void)
          update_viewports = true;
    }
 
+#ifdef USE_SCD_THREAD
+   var.key = "scd_thread";
+
+   if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var))
+   {
+      if (strcmp(var.value, "disabled") == 0)
+         config.scd_thread = 0;
+      else if (strcmp(var.value, "enabled") == 0)
+         config.scd_thread = 1;
+   }
+#endif
+
    if (update_viewports)
       retro_set_viewport_dimensions();
 }
@@ -707,6 +738,9 @@ bool retro_load_game(const struct retro_game_info *info)
    snprintf(CD_BRAM_US, sizeof(CD_BRAM_US), "%s%cscd_U.brm", dir, slash);
    snprintf(CD_BRAM_JP, sizeof(CD_BRAM_JP), "%s%cscd_J.brm", dir, slash);
    snprintf(CART_BRAM, sizeof(CART_BRAM), "%s%ccart.brm", dir, slash);
+#ifdef USE_ROM_CACHE
+   snprintf(ROM_CACHE_PATH, sizeof(ROM_CACHE_PATH), "%s", dir);
+#endif
    fprintf(stderr, "Sega CD EU BIOS should be located at: %s\n", CD_BIOS_EU);
    fprintf(stderr, "Sega CD US BIOS should be located at: %s\n", CD_BIOS_US);
    fprintf(stderr, "Sega CD JP BIOS should be located at: %s\n", CD_BIOS_JP);
@@ -720,6 +754,18 @@ bool retro_load_game(const struct retro_game_info *info)
    config_default();
    init_bitmap();
 
+#ifdef USE_ROM_CACHE
+   /* ROM image cache is set up while loading ROM */
+   {
+      struct retro_variable var = {0};
+
+      var.key = "rom_cache";
+
+      if (environ_cb(RETRO_ENVIRONMENT_GET_VARIABLE, &var) && var.value)
+         config.rom_cache = (strcmp(var.value, "enabled") == 0);
+   }
+#endif
+
    full_path = info->path;
 
    if (!LoadFile((char *)full_path))
@@ -753,7 +799,16 @@ bool retro_load_game_special(unsigned game_type, const struct retro_game_info *i
 void retro_unload_game(void) 
 {
    if (system_hw == SYSTEM_MCD)
+   {
+#ifdef USE_SCD_THREAD
+      scd_thread_stop();
+#endif
       bram_save();
+   }
+
+#ifdef LOW_MEMORY
+   system_shutdown();
+#endif
 }
 
 unsigned retro_get_region(void) { return vdp_pal ? RETRO_REGION_PAL : RETRO_REGION_NTSC; }
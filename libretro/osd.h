@@ -64,6 +64,12 @@ typedef struct
   uint8 ntsc;
   uint8 gg_extra;
   uint8 render;
+#ifdef USE_SCD_THREAD
+  uint8 scd_thread;
+#endif
+#ifdef USE_ROM_CACHE
+  uint8 rom_cache;
+#endif
   t_input_config input[MAX_INPUTS];
 } t_config;
 
@@ -81,6 +87,9 @@ extern char CD_BIOS_JP[256];
 extern char MS_BIOS_US[256];
 extern char MS_BIOS_EU[256];
 extern char MS_BIOS_JP[256];
+#ifdef USE_ROM_CACHE
+extern char ROM_CACHE_PATH[256];
+#endif
 
 extern int16 soundbuffer[3068];
 
@@ -0,0 +1,195 @@
+/***************************************************************************************
+ *  Genesis Plus
+ *  Compressed CD image (.cdz) creation tool
+ *
+ *  usage: mkcdz <output.cdz> <data track .iso/.bin> [audio track .wav/.bin ...]
+ *
+ *  Audio tracks are placed after the DATA track with a 2s PAUSE between tracks,
+ *  the same way separate audio track files are loaded by the emulator.
+ *  see core/cd_hw/cdz.h for file layout.
+ *
+ *  build: gcc -O2 -o mkcdz mkcdz.c -lz
+ *
+ ****************************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#define HUNK_SECTORS 8
+#define HUNK_SIZE (HUNK_SECTORS * 2352)
+#define MAX_TRACKS 99
+
+static unsigned char *image;
+static unsigned int sectors;
+static unsigned int toc[MAX_TRACKS * 2];
+
+static void write_le32(FILE *fd, unsigned int data)
+{
+  unsigned char buf[4];
+  buf[0] = data;
+  buf[1] = data >> 8;
+  buf[2] = data >> 16;
+  buf[3] = data >> 24;
+  fwrite(buf, 4, 1, fd);
+}
+
+static int add_track(const char *filename, int track)
+{
+  unsigned char *data;
+  long size;
+  int i, blocks, pregap = 0, sectorSize = 2352, offset = 0;
+
+  FILE *fd = fopen(filename, "rb");
+  if (!fd)
+  {
+    fprintf(stderr, "unable to open %s\n", filename);
+    return 0;
+  }
+
+  fseek(fd, 0, SEEK_END);
+  size = ftell(fd);
+  fseek(fd, 0, SEEK_SET);
+  data = malloc(size);
+  if (!data || (fread(data, size, 1, fd) != 1))
+  {
+    fprintf(stderr, "unable to read %s\n", filename);
+    fclose(fd);
+    return 0;
+  }
+  fclose(fd);
+
+  if (!track)
+  {
+    /* ISO format (2048 bytes data blocks) */
+    if (!memcmp("SEGADISCSYSTEM", data, 14))
+    {
+      sectorSize = 2048;
+    }
+  }
+  else
+  {
+    /* 2s PAUSE between tracks */
+    pregap = 150;
+
+    /* WAVE file header */
+    if (!memcmp("RIFF", data, 4) && !memcmp("WAVE", data + 8, 4))
+    {
+      offset = 44;
+    }
+  }
+
+  blocks = (size - offset + sectorSize - 1) / sectorSize;
+  image = realloc(image, (sectors + pregap + blocks) * 2352);
+  if (!image)
+  {
+    fprintf(stderr, "out of memory\n");
+    return 0;
+  }
+
+  /* PAUSE sectors and end of last block are left blank */
+  memset(image + sectors * 2352, 0, (pregap + blocks) * 2352);
+  sectors += pregap;
+
+  for (i = 0; i < blocks; i++)
+  {
+    int len = size - offset - (i * sectorSize);
+    if (len > sectorSize) len = sectorSize;
+
+    if (sectorSize == 2048)
+    {
+      /* Mode 1 sector: only data field is used by emulator */
+      memcpy(image + (sectors + i) * 2352 + 16, data + i * 2048, len);
+      image[(sectors + i) * 2352 + 15] = 0x01;
+    }
+    else
+    {
+      memcpy(image + (sectors + i) * 2352, data + offset + i * 2352, len);
+    }
+  }
+
+  free(data);
+
+  toc[track * 2] = sectors;
+  toc[track * 2 + 1] = sectors + blocks;
+  sectors += blocks;
+  return 1;
+}
+
+int main(int argc, char **argv)
+{
+  unsigned int i, hunks, tracks;
+  unsigned long *offsets;
+  unsigned char *buf;
+  FILE *fd;
+
+  if ((argc < 3) || (argc > (MAX_TRACKS + 2)))
+  {
+    fprintf(stderr, "usage: mkcdz <output.cdz> <data track .iso/.bin> [audio track .wav/.bin ...]\n");
+    return 1;
+  }
+
+  tracks = argc - 2;
+  for (i = 0; i < tracks; i++)
+  {
+    if (!add_track(argv[i + 2], i))
+    {
+      return 1;
+    }
+  }
+
+  fd = fopen(argv[1], "wb");
+  if (!fd)
+  {
+    fprintf(stderr, "unable to create %s\n", argv[1]);
+    return 1;
+  }
+
+  /* header & TOC */
+  hunks = (sectors + HUNK_SECTORS - 1) / HUNK_SECTORS;
+  fwrite("CDZ1", 4, 1, fd);
+  write_le32(fd, HUNK_SECTORS);
+  write_le32(fd, sectors);
+  write_le32(fd, tracks);
+  for (i = 0; i < tracks * 2; i++)
+  {
+    write_le32(fd, toc[i]);
+  }
+
+  /* hunk offsets are written once hunks have been compressed */
+  offsets = malloc((hunks + 1) * sizeof(unsigned long));
+  offsets[0] = 16 + (tracks * 2 + hunks + 1) * 4;
+  fseek(fd, offsets[0], SEEK_SET);
+
+  image = realloc(image, hunks * HUNK_SIZE);
+  memset(image + sectors * 2352, 0, hunks * HUNK_SIZE - sectors * 2352);
+  buf = malloc(compressBound(HUNK_SIZE));
+
+  for (i = 0; i < hunks; i++)
+  {
+    uLongf len = compressBound(HUNK_SIZE);
+
+    if ((compress2(buf, &len, image + i * HUNK_SIZE, HUNK_SIZE, 9) == Z_OK) && (len < HUNK_SIZE))
+    {
+      fwrite(buf, len, 1, fd);
+    }
+    else
+    {
+      /* store uncompressed */
+      len = HUNK_SIZE;
+      fwrite(image + i * HUNK_SIZE, HUNK_SIZE, 1, fd);
+    }
+
+    offsets[i + 1] = offsets[i] + len;
+  }
+
+  fseek(fd, 16 + tracks * 2 * 4, SEEK_SET);
+  for (i = 0; i <= hunks; i++)
+  {
+    write_le32(fd, offsets[i]);
+  }
+
+  fclose(fd);
+  return 0;
+}